@@ -20,6 +20,7 @@
 #ifndef ZEPHYR_INCLUDE_WEAVE_CORE_H_
 #define ZEPHYR_INCLUDE_WEAVE_CORE_H_
 
+#include <limits.h>
 #include <zephyr/kernel.h>
 #include <zephyr/sys/slist.h>
 #include <zephyr/sys/iterable_sections.h>
@@ -57,6 +58,24 @@ struct weave_source;
  */
 typedef void (*weave_handler_t)(void *ptr, void *user_data);
 
+/**
+ * @brief Payload producer for weave_source_emit_lazy()
+ *
+ * @param ptr Set to the produced payload on success
+ * @param user_data User data passed to weave_source_emit_lazy()
+ * @return 0 on success, negative errno to abort the emit
+ */
+typedef int (*weave_producer_t)(void **ptr, void *user_data);
+
+/**
+ * @brief Batch handler function signature
+ *
+ * @param ptrs Array of payload pointers (borrowed, released after return)
+ * @param count Number of payloads in ptrs
+ * @param user_data User data from batch sink definition
+ */
+typedef void (*weave_batch_handler_t)(void *const *ptrs, size_t count, void *user_data);
+
 /**
  * @brief Payload operations for lifecycle management
  *
@@ -66,11 +85,23 @@ typedef void (*weave_handler_t)(void *ptr, void *user_data);
  * - Simple pointers with no lifecycle
  */
 struct weave_payload_ops {
+	/** Optional per-sink filter, called before ref.
+	 *  Return 0 to accept, negative to skip this sink.
+	 *  When provided, ref must not filter and sinks sharing a queue
+	 *  can share one reference (see CONFIG_WEAVE_EVENT_MAX_TARGETS). */
+	int (*filter)(void *ptr, struct weave_sink *sink);
+	/** Optional payload-free filter for weave_source_would_deliver().
+	 *  Return true if the sink would accept payloads described by key
+	 *  (e.g. a packet ID). NULL means every sink accepts every key. */
+	bool (*accepts)(const void *key, const struct weave_sink *sink);
 	/** Called before delivery to take reference and optionally filter.
 	 *  Return 0 on success (ref taken), negative to skip this sink. */
 	int (*ref)(void *ptr, struct weave_sink *sink);
 	/** Called after handler or on failure to release reference */
 	void (*unref)(void *ptr);
+	/** Optional: releases a reference ref took for sink, instead of
+	 *  unref. Lets ops attribute references to the sinks holding them. */
+	void (*release)(void *ptr, struct weave_sink *sink);
 };
 
 /**
@@ -85,6 +116,36 @@ struct weave_source {
 	const struct weave_payload_ops *ops;
 };
 
+/**
+ * @brief Credit pool of a flow-controlled sink
+ *
+ * Each queued delivery to the sink consumes one credit; the credit is
+ * returned once the handler has processed the event.
+ */
+struct weave_credits {
+	/** Credits currently available */
+	atomic_t available;
+	/** Credits granted in total (events in flight at most) */
+	uint32_t limit;
+	/** Given when a credit returns to an exhausted pool */
+	struct k_sem returned;
+};
+
+/**
+ * @brief Work queue binding of a work sink
+ *
+ * Events for the sink are stored in a private queue that no thread
+ * waits on; each delivery submits one work item that drains it.
+ */
+struct weave_sink_work {
+	/** Work item draining the queue */
+	struct k_work work;
+	/** Work queue to run on (NULL = system work queue) */
+	struct k_work_q *work_q;
+	/** Private event queue of the sink */
+	struct k_msgq *queue;
+};
+
 /**
  * @brief Weave sink structure
  *
@@ -98,6 +159,70 @@ struct weave_sink {
 	void *user_data;
 	/** Message queue (NULL = immediate mode) */
 	struct k_msgq *queue;
+#ifdef CONFIG_WEAVE_FLOW_CONTROL
+	/** Credit pool for queued deliveries (NULL = no flow control) */
+	struct weave_credits *credits;
+#endif
+#ifdef CONFIG_WEAVE_WORK_SINK
+	/** Work queue binding (NULL = queue drained by a thread) */
+	struct weave_sink_work *work;
+#endif
+#ifdef CONFIG_WEAVE_WAKE_MODERATION
+	/** Wake moderation of queue (NULL = not moderated), looked up on connect or first send */
+	struct weave_moderation *moderation;
+	/** moderation has been looked up */
+	bool moderation_resolved;
+#endif
+#ifdef CONFIG_WEAVE_POLL
+	/** Pollable queue of queue (NULL = not pollable), looked up on connect or first send */
+	struct weave_poll_queue *poll;
+	/** poll has been looked up */
+	bool poll_resolved;
+#endif
+};
+
+/**
+ * @brief Weave batch sink structure
+ *
+ * A sink whose handler receives several payloads per call. Consecutive
+ * queued events for the sink are gathered (up to max_batch) and handed
+ * over in one call; references are released after the handler returns.
+ * Immediate and multi-target deliveries arrive with count 1.
+ */
+struct weave_batch_sink {
+	/** Embedded sink (handler is weave_batch_dispatch) */
+	struct weave_sink sink;
+	/** Batch handler function */
+	weave_batch_handler_t handler;
+	/** User data passed to batch handler */
+	void *user_data;
+	/** Maximum payloads per handler call */
+	size_t max_batch;
+};
+
+/**
+ * @brief Weave adaptive sink structure
+ *
+ * A sink that times its handler and switches itself between immediate
+ * execution in the producer and deferral to its queue. The handler is
+ * deferred once its average execution time exceeds defer_ns, and runs
+ * immediately again once the average drops below inline_ns.
+ */
+struct weave_adaptive_sink {
+	/** Embedded sink (handler is weave_adaptive_dispatch) */
+	struct weave_sink sink;
+	/** Handler function */
+	weave_handler_t handler;
+	/** User data passed to handler */
+	void *user_data;
+	/** Average above which the handler is deferred (nanoseconds) */
+	uint32_t defer_ns;
+	/** Average below which the handler runs immediately (nanoseconds) */
+	uint32_t inline_ns;
+	/** Moving average of handler execution time (nanoseconds) */
+	uint32_t avg_ns;
+	/** Non-zero while deliveries go through the queue */
+	atomic_t deferred;
 };
 
 /**
@@ -118,6 +243,10 @@ struct weave_connection {
  * @brief Event structure for queued delivery
  *
  * Passed through message queue for deferred processing.
+ * With CONFIG_WEAVE_EVENT_MAX_TARGETS > 1, one event can carry several
+ * sinks sharing the queue. All targets share a single payload reference.
+ * With CONFIG_WEAVE_VALUE_MAX_SIZE > 0, small payloads can travel inside
+ * the event itself instead of by pointer.
  */
 struct weave_event {
 	/** Target sink */
@@ -126,6 +255,36 @@ struct weave_event {
 	void *ptr;
 	/** Payload ops for unref (same ops that did ref) */
 	const struct weave_payload_ops *ops;
+#if CONFIG_WEAVE_EVENT_MAX_TARGETS > 1
+	/** Additional target sinks, invoked in order after sink (NULL = unused) */
+	struct weave_sink *more[CONFIG_WEAVE_EVENT_MAX_TARGETS - 1];
+#endif
+#if CONFIG_WEAVE_VALUE_MAX_SIZE > 0
+	/** Inline copy of a by-value payload (see weave_source_emit_value) */
+	uint8_t value[CONFIG_WEAVE_VALUE_MAX_SIZE] __aligned(8);
+#endif
+};
+
+/**
+ * @brief Wake moderation state of a queue
+ *
+ * Consumers of a moderated queue sleep on a semaphore instead of the
+ * queue itself. Producers give it once max_events events are pending or
+ * max_delay_us after the first pending event, whichever comes first.
+ */
+struct weave_moderation {
+	/** Moderated message queue */
+	struct k_msgq *queue;
+	/** Pending events that wake the consumer */
+	uint32_t max_events;
+	/** Longest time the first pending event waits (microseconds) */
+	uint32_t max_delay_us;
+	/** Events queued since the consumer last woke */
+	atomic_t pending;
+	/** Consumer wake-up */
+	struct k_sem wake;
+	/** Delay timer, armed by the first pending event */
+	struct k_timer timer;
 };
 
 /* ============================ Macros ============================ */
@@ -187,6 +346,149 @@ struct weave_event {
  */
 #define WEAVE_SINK_DECLARE(_name) extern struct weave_sink _name
 
+/**
+ * @brief Define a source for by-value messages of a given type
+ *
+ * The source has no payload ops: messages are copied into each delivery
+ * with weave_source_emit_value() (or WEAVE_VALUE_EMIT), so there is no
+ * pool and no ref/unref, and any number of sinks can be connected.
+ *
+ * @param _name Source variable name
+ * @param _type Message type (at most CONFIG_WEAVE_VALUE_MAX_SIZE bytes)
+ */
+#define WEAVE_VALUE_SOURCE_DEFINE(_name, _type)                                                    \
+	BUILD_ASSERT(sizeof(_type) <= CONFIG_WEAVE_VALUE_MAX_SIZE,                                 \
+		     "By-value message larger than CONFIG_WEAVE_VALUE_MAX_SIZE");                  \
+	WEAVE_SOURCE_DEFINE(_name, WV_NO_OPS)
+
+/**
+ * @brief Emit a by-value message, taking its size from the object
+ *
+ * @param _source Pointer to the source
+ * @param _value Pointer to the message (copied before return)
+ * @param _timeout Maximum time for all deliveries
+ */
+#define WEAVE_VALUE_EMIT(_source, _value, _timeout)                                                \
+	weave_source_emit_value((_source), (_value), sizeof(*(_value)), (_timeout))
+
+/**
+ * @brief Define a batch sink
+ *
+ * Batching gathers consecutive events of the sink, so give batch sinks
+ * their own queue for the largest batches. The effective batch size is
+ * also bounded by CONFIG_WEAVE_PROCESS_BATCH_SIZE.
+ *
+ * @param _name Batch sink variable name
+ * @param _handler Batch handler function
+ * @param _queue Message queue (WV_IMMEDIATE for immediate mode, or &queue for queued)
+ * @param _max_batch Maximum payloads per handler call (at least 1)
+ * @param _user_data User data pointer (NULL if unused)
+ */
+#define WEAVE_BATCH_SINK_DEFINE(_name, _handler, _queue, _max_batch, _user_data)                   \
+	BUILD_ASSERT((_max_batch) > 0, "Batch size must be at least 1");                           \
+	struct weave_batch_sink _name = {                                                          \
+		.sink = WEAVE_SINK_INITIALIZER(weave_batch_dispatch, (_queue), &_name),            \
+		.handler = (_handler),                                                             \
+		.user_data = (void *)(_user_data),                                                 \
+		.max_batch = (_max_batch),                                                         \
+	}
+
+/**
+ * @brief Declare a batch sink (for header files)
+ *
+ * @param _name Batch sink variable name
+ */
+#define WEAVE_BATCH_SINK_DECLARE(_name) extern struct weave_batch_sink _name
+
+/**
+ * @brief Define a flow-controlled sink
+ *
+ * At most _credits events for the sink are queued at any time. Further
+ * deliveries fail with -ENOBUFS until the handler catches up. Also
+ * defines the credit pool (_name##_credits). Requires
+ * CONFIG_WEAVE_FLOW_CONTROL.
+ *
+ * @param _name Sink variable name
+ * @param _handler Handler function
+ * @param _queue Message queue (must not be WV_IMMEDIATE)
+ * @param _credits Number of credits (at least 1)
+ * @param _user_data User data pointer (NULL if unused)
+ */
+#define WEAVE_FLOW_SINK_DEFINE(_name, _handler, _queue, _credits, _user_data)                      \
+	BUILD_ASSERT((_credits) > 0, "Flow-controlled sink needs at least one credit");            \
+	static struct weave_credits _name##_credits = {                                            \
+		.available = ATOMIC_INIT(_credits),                                                \
+		.limit = (_credits),                                                               \
+		.returned = Z_SEM_INITIALIZER(_name##_credits.returned, 0, 1),                     \
+	};                                                                                         \
+	struct weave_sink _name = {                                                                \
+		.handler = (_handler),                                                             \
+		.user_data = (void *)(_user_data),                                                 \
+		.queue = (_queue),                                                                 \
+		.credits = &_name##_credits,                                                       \
+	}
+
+/** @brief Run a work sink on the system work queue */
+#define WV_SYSTEM_WORKQ NULL
+
+/**
+ * @brief Define a sink that runs on a work queue
+ *
+ * Deliveries are stored in a private queue of _depth events and handled
+ * by a work item on _work_q, so the sink needs no thread of its own.
+ * Requires CONFIG_WEAVE_WORK_SINK.
+ *
+ * @param _name Sink variable name
+ * @param _handler Handler function
+ * @param _work_q Work queue pointer (WV_SYSTEM_WORKQ for the system work queue)
+ * @param _depth Maximum number of pending events
+ * @param _user_data User data pointer (NULL if unused)
+ */
+#define WEAVE_WORK_SINK_DEFINE(_name, _handler, _work_q, _depth, _user_data)                       \
+	WEAVE_MSGQ_DEFINE(_name##_msgq, _depth);                                                   \
+	static struct weave_sink_work _name##_work = {                                             \
+		.work = Z_WORK_INITIALIZER(weave_sink_work_handler),                               \
+		.work_q = (_work_q),                                                               \
+		.queue = &_name##_msgq,                                                            \
+	};                                                                                         \
+	struct weave_sink _name = {                                                                \
+		.handler = (_handler),                                                             \
+		.user_data = (void *)(_user_data),                                                 \
+		.queue = &_name##_msgq,                                                            \
+		.work = &_name##_work,                                                             \
+	}
+
+/**
+ * @brief Define an adaptive sink
+ *
+ * The sink starts out deferred and moves to immediate execution once its
+ * handler proves cheap. Switching back to the queue happens above
+ * _defer_us, switching to immediate below half of it (hysteresis).
+ *
+ * @param _name Adaptive sink variable name
+ * @param _handler Handler function
+ * @param _queue Message queue used while deferred (must not be WV_IMMEDIATE)
+ * @param _defer_us Average handler time that triggers deferral (microseconds)
+ * @param _user_data User data pointer (NULL if unused)
+ */
+#define WEAVE_ADAPTIVE_SINK_DEFINE(_name, _handler, _queue, _defer_us, _user_data)                 \
+	BUILD_ASSERT((_defer_us) > 0 && (_defer_us) <= 1000000, "Threshold out of range");        \
+	struct weave_adaptive_sink _name = {                                                       \
+		.sink = WEAVE_SINK_INITIALIZER(weave_adaptive_dispatch, (_queue), &_name),         \
+		.handler = (_handler),                                                             \
+		.user_data = (void *)(_user_data),                                                 \
+		.defer_ns = (_defer_us) * 1000U,                                                   \
+		.inline_ns = (_defer_us) * 500U,                                                   \
+		.deferred = ATOMIC_INIT(1),                                                        \
+	}
+
+/**
+ * @brief Declare an adaptive sink (for header files)
+ *
+ * @param _name Adaptive sink variable name
+ */
+#define WEAVE_ADAPTIVE_SINK_DECLARE(_name) extern struct weave_adaptive_sink _name
+
 /**
  * @brief Define a message queue for weave events
  *
@@ -195,6 +497,29 @@ struct weave_event {
  */
 #define WEAVE_MSGQ_DEFINE(_name, _depth) K_MSGQ_DEFINE(_name, sizeof(struct weave_event), _depth, 4)
 
+/**
+ * @brief Define a message queue with consumer wake moderation
+ *
+ * Also defines the moderation state (_name##_moderation), which the
+ * consumer passes to weave_process_moderated(). Requires
+ * CONFIG_WEAVE_WAKE_MODERATION.
+ *
+ * @param _name Queue variable name
+ * @param _depth Maximum number of events
+ * @param _max_events Wake the consumer once this many events are pending
+ * @param _max_delay_us Wake the consumer this long after the first pending event
+ */
+#define WEAVE_MODERATED_MSGQ_DEFINE(_name, _depth, _max_events, _max_delay_us)                     \
+	BUILD_ASSERT((_max_events) > 0 && (_max_events) <= (_depth),                               \
+		     "Wake threshold must be within queue depth");                                 \
+	WEAVE_MSGQ_DEFINE(_name, _depth);                                                          \
+	STRUCT_SECTION_ITERABLE(weave_moderation, _name##_moderation) = {                          \
+		.queue = &_name,                                                                   \
+		.max_events = (_max_events),                                                       \
+		.max_delay_us = (_max_delay_us),                                                   \
+		.wake = Z_SEM_INITIALIZER(_name##_moderation.wake, 0, 1),                          \
+	}
+
 /**
  * @brief Connect a source to a sink (compile-time)
  *
@@ -209,6 +534,23 @@ struct weave_event {
 		.sink = (_sink),                                                                   \
 	}
 
+/**
+ * @brief Connect a source to a batch sink (compile-time)
+ *
+ * @param _source Pointer to source
+ * @param _batch_sink Batch sink variable (not pointer)
+ */
+#define WEAVE_BATCH_CONNECT(_source, _batch_sink) WEAVE_CONNECT(_source, &(_batch_sink).sink)
+
+/**
+ * @brief Connect a source to an adaptive sink (compile-time)
+ *
+ * @param _source Pointer to source
+ * @param _adaptive_sink Adaptive sink variable (not pointer)
+ */
+#define WEAVE_ADAPTIVE_CONNECT(_source, _adaptive_sink)                                            \
+	WEAVE_CONNECT(_source, &(_adaptive_sink).sink)
+
 /* ============================ Function APIs ============================ */
 
 /**
@@ -220,6 +562,10 @@ struct weave_event {
  * - Ref is called before delivery
  * - Unref is called after handler or on failure
  *
+ * If the ops provide a filter (or no ref), queued sinks sharing the same
+ * queue are grouped into one event with a single reference, up to
+ * CONFIG_WEAVE_EVENT_MAX_TARGETS sinks per event.
+ *
  * The timeout is distributed across sinks - if one blocks, remaining
  * sinks get the remaining time.
  *
@@ -231,6 +577,94 @@ struct weave_event {
  */
 int weave_source_emit(struct weave_source *source, void *ptr, k_timeout_t timeout);
 
+/**
+ * @brief Check whether an emit could reach at least one sink
+ *
+ * Cheap, payload-free query: walks the source's connections and asks the
+ * ops' accepts callback (if any) about key. Use it to skip building
+ * payloads nobody will receive, e.g. for disabled debug streams.
+ *
+ * @param source Pointer to the source
+ * @param key Payload description understood by the ops (NULL = any payload)
+ *
+ * @return true if at least one connected sink would accept the payload
+ */
+bool weave_source_would_deliver(struct weave_source *source, const void *key);
+
+/**
+ * @brief Emit a payload that is only produced if some sink will take it
+ *
+ * Calls produce only when weave_source_would_deliver() is true, then
+ * emits the produced payload. The producer's reference is released
+ * afterwards if the ops take a reference per sink. With transfer
+ * semantics (unref but no ref), it is released only if nothing was
+ * delivered.
+ *
+ * @param source Pointer to the source
+ * @param key Payload description for weave_source_would_deliver()
+ * @param produce Producer callback
+ * @param user_data User data passed to produce
+ * @param timeout Maximum time for all deliveries
+ *
+ * @return Number of successful deliveries (0 without calling produce if
+ *         no sink would accept), or negative errno (including the
+ *         producer's error)
+ */
+int weave_source_emit_lazy(struct weave_source *source, const void *key, weave_producer_t produce,
+			   void *user_data, k_timeout_t timeout);
+
+/**
+ * @brief Get the credits a sink has left
+ *
+ * Requires CONFIG_WEAVE_FLOW_CONTROL.
+ *
+ * @param sink Pointer to the sink
+ *
+ * @return Number of queued deliveries the sink accepts right now, or
+ *         INT_MAX if the sink is not flow-controlled
+ */
+int weave_sink_credits(const struct weave_sink *sink);
+
+/**
+ * @brief Get the credits of the most loaded sink of a source
+ *
+ * Cheap check before building a payload: if this returns 0, at least one
+ * connected sink would drop an emit made now. Requires
+ * CONFIG_WEAVE_FLOW_CONTROL.
+ *
+ * @param source Pointer to the source
+ *
+ * @return Minimum credits over the connected flow-controlled sinks, or
+ *         INT_MAX if none is flow-controlled
+ */
+int weave_source_credits(struct weave_source *source);
+
+/**
+ * @brief Wait until every flow-controlled sink of a source has a credit
+ *
+ * Sleeps until credits return instead of polling. Requires
+ * CONFIG_WEAVE_FLOW_CONTROL.
+ *
+ * @param source Pointer to the source
+ * @param timeout Maximum time to wait
+ *
+ * @return 0 when all sinks have credits, -EAGAIN on timeout,
+ *         -EINVAL on invalid arguments
+ */
+int weave_source_wait_credits(struct weave_source *source, k_timeout_t timeout);
+
+/**
+ * @brief Restore all credits of a sink
+ *
+ * For use after purging the sink's queue, which discards events without
+ * returning their credits. Events still being handled when the credits
+ * are reset return nothing once freed, so available never exceeds the
+ * limit. Requires CONFIG_WEAVE_FLOW_CONTROL.
+ *
+ * @param sink Pointer to the sink
+ */
+void weave_sink_credits_reset(struct weave_sink *sink);
+
 /**
  * @brief Send a message directly to a sink
  *
@@ -247,20 +681,181 @@ int weave_source_emit(struct weave_source *source, void *ptr, k_timeout_t timeou
 int weave_sink_send(struct weave_sink *sink, void *ptr, const struct weave_payload_ops *ops,
 		    k_timeout_t timeout);
 
+/**
+ * @brief Emit a small message by value to all connected sinks
+ *
+ * Copies the message once per sink: into the queue event for queued
+ * sinks, or into a stack buffer for immediate sinks. Handlers receive a
+ * pointer to their own copy, valid only for the duration of the call.
+ * No payload ops are involved, so the caller keeps ownership of value.
+ *
+ * @param source Pointer to the source
+ * @param value Pointer to the message
+ * @param size Message size in bytes (at most CONFIG_WEAVE_VALUE_MAX_SIZE)
+ * @param timeout Maximum time for all deliveries
+ *
+ * @return Number of successful deliveries, -EMSGSIZE if size is too large,
+ *         or negative errno
+ */
+int weave_source_emit_value(struct weave_source *source, const void *value, size_t size,
+			    k_timeout_t timeout);
+
+/**
+ * @brief Send a small message by value directly to a sink
+ *
+ * @param sink Pointer to the sink
+ * @param value Pointer to the message
+ * @param size Message size in bytes (at most CONFIG_WEAVE_VALUE_MAX_SIZE)
+ * @param timeout Maximum time for delivery
+ *
+ * @return 0 on success, -EMSGSIZE if size is too large, negative errno on failure
+ */
+int weave_sink_send_value(struct weave_sink *sink, const void *value, size_t size,
+			  k_timeout_t timeout);
+
+/**
+ * @brief Connect a source to a sink at runtime
+ *
+ * Links a caller-provided connection into the source's sink list. Emits
+ * running concurrently see either the old or the new list, never block
+ * and take no lock. Requires CONFIG_WEAVE_RUNTIME_CONNECT.
+ *
+ * @param conn Connection storage (zero-initialized, owned by the caller)
+ * @param source Pointer to the source
+ * @param sink Pointer to the sink
+ *
+ * @return 0 on success, -EALREADY if conn is already connected,
+ *         -EINVAL on invalid arguments
+ */
+int weave_connect(struct weave_connection *conn, struct weave_source *source,
+		  struct weave_sink *sink);
+
+/**
+ * @brief Disconnect a runtime or static connection
+ *
+ * Unlinks the connection, then waits for a grace period until no emit
+ * can still be traversing it. Afterwards conn may be reused or freed.
+ * Events already queued for the sink are still delivered.
+ *
+ * Must not be called from an ISR or from a sink handler run by an emit
+ * (that emit would never finish its traversal). With
+ * CONFIG_THREAD_LOCAL_STORAGE such a call fails with -EDEADLK, otherwise
+ * it hangs. Requires CONFIG_WEAVE_RUNTIME_CONNECT.
+ *
+ * @param conn Connection to remove
+ *
+ * @return 0 on success, -ENOENT if not linked, -EWOULDBLOCK in ISR,
+ *         -EDEADLK from within an emit, -EINVAL on invalid arguments
+ */
+int weave_disconnect(struct weave_connection *conn);
+
 /**
  * @brief Process messages from a queue
  *
  * Waits for the first message with the given timeout, then drains
  * all remaining available messages without blocking.
- * Calls each sink's handler and manages lifecycle via ops.
+ * Calls each target sink's handler and manages lifecycle via ops.
  *
  * @param queue Pointer to the message queue
  * @param timeout Maximum time to wait for the first message
  *
- * @return Number of messages processed, or negative errno on error
+ * @return Number of handler invocations, or negative errno on error
  */
 int weave_process_messages(struct k_msgq *queue, k_timeout_t timeout);
 
+/**
+ * @brief Work handler of every work sink
+ *
+ * Drains the sink's private queue. Do not call directly.
+ *
+ * @param work Work item embedded in weave_sink_work
+ */
+void weave_sink_work_handler(struct k_work *work);
+
+/**
+ * @brief Process messages from a moderated queue
+ *
+ * Sleeps until the producers' moderation wakes the consumer (or an urgent
+ * emit does), then drains the queue like weave_process_messages().
+ * Requires CONFIG_WEAVE_WAKE_MODERATION.
+ *
+ * @param mod Moderation state (_name##_moderation of the queue)
+ * @param timeout Maximum time to wait for the wake-up
+ *
+ * @return Number of handler invocations, or negative errno on error
+ */
+int weave_process_moderated(struct weave_moderation *mod, k_timeout_t timeout);
+
+/**
+ * @brief Emit a message and wake moderated consumers right away
+ *
+ * Like weave_source_emit(), but bypasses wake moderation for the queues
+ * of the source's sinks: use for payloads that must not wait for a batch
+ * to fill. Without CONFIG_WEAVE_WAKE_MODERATION this is a plain emit.
+ *
+ * @param source Pointer to the source
+ * @param ptr Payload pointer
+ * @param timeout Maximum time for all deliveries
+ *
+ * @return Number of successful deliveries, or negative errno
+ */
+int weave_source_emit_urgent(struct weave_source *source, void *ptr, k_timeout_t timeout);
+
+/**
+ * @brief Dispatch function for batch sinks
+ *
+ * Handler of every batch sink. Delivers a single payload (count 1) when
+ * the event cannot be batched. Do not call directly.
+ *
+ * @param ptr Payload pointer
+ * @param user_data Pointer to weave_batch_sink
+ */
+void weave_batch_dispatch(void *ptr, void *user_data);
+
+/**
+ * @brief Dispatch function for adaptive sinks
+ *
+ * Handler of every adaptive sink. Times the user handler and updates the
+ * sink's mode. Do not call directly.
+ *
+ * @param ptr Payload pointer
+ * @param user_data Pointer to weave_adaptive_sink
+ */
+void weave_adaptive_dispatch(void *ptr, void *user_data);
+
+/**
+ * @brief Check whether an adaptive sink currently defers to its queue
+ *
+ * @param adaptive Pointer to the adaptive sink
+ * @return true if deliveries are queued, false if handled immediately
+ */
+static inline bool weave_adaptive_sink_is_deferred(const struct weave_adaptive_sink *adaptive)
+{
+	return atomic_get(&adaptive->deferred) != 0;
+}
+
+/**
+ * @brief Get the user context of a sink
+ *
+ * Returns the batch or adaptive sink's user_data for those sinks, or the
+ * sink's own user_data otherwise. Payload ops use this to find per-sink settings
+ * such as filters regardless of the sink flavour.
+ *
+ * @param sink Pointer to the sink
+ * @return User context pointer
+ */
+static inline void *weave_sink_context(const struct weave_sink *sink)
+{
+	if (sink->handler == weave_batch_dispatch) {
+		return ((struct weave_batch_sink *)sink->user_data)->user_data;
+	}
+	if (sink->handler == weave_adaptive_dispatch) {
+		return ((struct weave_adaptive_sink *)sink->user_data)->user_data;
+	}
+
+	return sink->user_data;
+}
+
 /** @} */
 
 #ifdef __cplusplus
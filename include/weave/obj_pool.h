@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Object Pool API
+ *
+ * Weave Object Pool - Reference counted typed objects on Weave core
+ *
+ * Fixed-size objects are allocated from a k_mem_slab with a compact
+ * atomic reference count placed right before each object. The pool
+ * supplies payload ops that take a reference per sink and free the
+ * block on the last release, so custom structs fan out zero-copy to
+ * any number of sinks, like net_buf packets do.
+ */
+
+#ifndef ZEPHYR_INCLUDE_WEAVE_OBJ_POOL_H_
+#define ZEPHYR_INCLUDE_WEAVE_OBJ_POOL_H_
+
+#include <weave/core.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup weave_obj_pool_apis Weave Object Pool APIs
+ * @ingroup os_services
+ * @{
+ */
+
+/* ============================ Type Definitions ============================ */
+
+/**
+ * @brief Object header, stored directly before each object
+ */
+struct weave_obj_hdr {
+	atomic_t refcount; /**< Number of holders of the object */
+};
+
+/**
+ * @brief Object pool
+ */
+struct weave_obj_pool {
+	struct k_mem_slab *slab;             /**< Underlying slab of blocks */
+	size_t hdr_size;                     /**< Bytes from block start to object */
+	const struct weave_payload_ops *ops; /**< Ref/unref ops for sources */
+};
+
+/* ============================ Layout Helpers ============================ */
+
+/** @brief Block alignment for objects of a type */
+#define WEAVE_OBJ_ALIGN(_type) MAX(__alignof__(_type), __alignof__(struct weave_obj_hdr))
+
+/** @brief Header area size, padded so the object stays aligned */
+#define WEAVE_OBJ_HDR_SIZE(_type) ROUND_UP(sizeof(struct weave_obj_hdr), __alignof__(_type))
+
+/** @brief Slab block size for objects of a type */
+#define WEAVE_OBJ_BLOCK_SIZE(_type)                                                                \
+	ROUND_UP(WEAVE_OBJ_HDR_SIZE(_type) + sizeof(_type), WEAVE_OBJ_ALIGN(_type))
+
+/* ============================ Pool Macros ============================ */
+
+/**
+ * @brief Define an object pool
+ *
+ * Also defines payload ops (_name##_ops) that take one reference per
+ * sink and return the block to the slab on the last unref.
+ *
+ * @param _name Pool variable name
+ * @param _type Object type
+ * @param _count Number of objects
+ */
+#define WEAVE_OBJ_POOL_DEFINE(_name, _type, _count)                                                \
+	K_MEM_SLAB_DEFINE_STATIC(_name##_slab, WEAVE_OBJ_BLOCK_SIZE(_type), _count,                \
+				 WEAVE_OBJ_ALIGN(_type));                                          \
+	static struct weave_obj_pool _name;                                                        \
+	static void _name##_unref(void *ptr)                                                       \
+	{                                                                                          \
+		weave_obj_unref(&_name, ptr);                                                      \
+	}                                                                                          \
+	static const struct weave_payload_ops _name##_ops = {                                      \
+		.ref = weave_obj_ops_ref,                                                          \
+		.unref = _name##_unref,                                                            \
+	};                                                                                         \
+	static struct weave_obj_pool _name = {                                                     \
+		.slab = &_name##_slab,                                                             \
+		.hdr_size = WEAVE_OBJ_HDR_SIZE(_type),                                             \
+		.ops = &_name##_ops,                                                               \
+	}
+
+/**
+ * @brief Define a source for objects of a pool
+ *
+ * @param _name Source variable name
+ * @param _pool Pool variable (defined with WEAVE_OBJ_POOL_DEFINE in the same file)
+ */
+#define WEAVE_OBJ_SOURCE_DEFINE(_name, _pool) WEAVE_SOURCE_DEFINE(_name, &_pool##_ops)
+
+/* ============================ Object API ============================ */
+
+/**
+ * @brief Allocate an object
+ *
+ * The object starts with one reference, owned by the caller. Its
+ * contents are not cleared.
+ *
+ * @param pool Pool to allocate from
+ * @param timeout Allocation timeout
+ * @return Pointer to the object, or NULL on timeout/failure
+ */
+void *weave_obj_alloc(struct weave_obj_pool *pool, k_timeout_t timeout);
+
+/**
+ * @brief Take an additional reference to an object
+ *
+ * @param obj Object from weave_obj_alloc()
+ * @return obj
+ */
+static inline void *weave_obj_ref(void *obj)
+{
+	struct weave_obj_hdr *hdr = (struct weave_obj_hdr *)obj - 1;
+
+	atomic_inc(&hdr->refcount);
+	return obj;
+}
+
+/**
+ * @brief Release a reference, freeing the object on the last one
+ *
+ * @param pool Pool the object was allocated from
+ * @param obj Object from weave_obj_alloc() (NULL is ignored)
+ */
+void weave_obj_unref(struct weave_obj_pool *pool, void *obj);
+
+/**
+ * @brief Get the current reference count of an object
+ *
+ * @param obj Object from weave_obj_alloc()
+ * @return Number of references
+ */
+static inline atomic_val_t weave_obj_refcount(const void *obj)
+{
+	const struct weave_obj_hdr *hdr = (const struct weave_obj_hdr *)obj - 1;
+
+	return atomic_get(&hdr->refcount);
+}
+
+/**
+ * @brief Ref callback shared by all object pools
+ *
+ * Takes one reference per sink. Do not call directly.
+ */
+int weave_obj_ops_ref(void *ptr, struct weave_sink *sink);
+
+/* ============================ Send Functions ============================ */
+
+/**
+ * @brief Send an object (consuming reference)
+ *
+ * Sends the object to all connected sinks, then releases the caller's
+ * reference. Do not use the object after calling this function.
+ *
+ * @param source Source defined with WEAVE_OBJ_SOURCE_DEFINE
+ * @param obj Object to send (caller's reference consumed)
+ * @param timeout Maximum time for all deliveries
+ * @return Number of successful deliveries, or negative errno
+ */
+static inline int weave_obj_send(struct weave_source *source, void *obj, k_timeout_t timeout)
+{
+	if (!source || !source->ops || !source->ops->unref || !obj) {
+		return -EINVAL;
+	}
+
+	int ret = weave_source_emit(source, obj, timeout);
+
+	source->ops->unref(obj);
+	return ret;
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_WEAVE_OBJ_POOL_H_ */
@@ -66,12 +66,94 @@ struct weave_packet_metadata {
 
 /* ============================ Buffer Pool ============================ */
 
+/**
+ * @brief Release callback for packets referencing external data
+ *
+ * Called once the last reference to the packet is gone, from the context
+ * that dropped it (possibly an ISR).
+ *
+ * @param data Payload passed to weave_packet_alloc_ref_data()
+ * @param user_data User data passed to weave_packet_alloc_ref_data()
+ */
+typedef void (*weave_packet_release_t)(const void *data, void *user_data);
+
+/**
+ * @brief External payload of a packet (one per buffer of a reference pool)
+ */
+struct weave_packet_ref {
+	const void *data;               /**< External payload */
+	weave_packet_release_t release; /**< Called on final unref, or NULL */
+	void *user_data;                /**< Passed to release */
+};
+
+/**
+ * @brief Allocation class of a pool with a reserve
+ */
+enum weave_packet_prio {
+	WEAVE_PACKET_PRIO_NORMAL, /**< weave_packet_alloc(), may not take reserved buffers */
+	WEAVE_PACKET_PRIO_HIGH,   /**< weave_packet_alloc_prio(), may take any buffer */
+	WEAVE_PACKET_PRIO_COUNT,
+};
+
+/**
+ * @brief Buffers of a pool held back for high-priority allocations
+ */
+struct weave_packet_reserve {
+	/** Buffers normal allocations may still take */
+	struct k_sem normal;
+	/** Buffers normal allocations may never take */
+	uint16_t reserved;
+	/** Buffers in use per allocation class */
+	atomic_t used[WEAVE_PACKET_PRIO_COUNT];
+	/** Allocation class of each buffer, by buffer ID */
+	uint8_t *prio;
+};
+
+struct weave_packet_borrow;
+
+/**
+ * @brief Buffers that elastic pools borrow when they are exhausted
+ */
+struct weave_packet_shared_reserve {
+	/** Underlying net_buf pool */
+	struct net_buf_pool *pool;
+	/** Data size of each buffer */
+	size_t size;
+	/** Borrower of each buffer, by buffer ID */
+	struct weave_packet_borrow **borrowers;
+};
+
+/**
+ * @brief Borrowing state and statistics of an elastic pool
+ *
+ * The counters can be read with atomic_get() to right-size the pool.
+ */
+struct weave_packet_borrow {
+	/** Shared reserve to borrow from */
+	struct weave_packet_shared_reserve *reserve;
+	/** Data size of the pool's own buffers, which borrowed ones must match */
+	size_t size;
+	/** Buffers borrowed at most at once */
+	uint16_t limit;
+	/** Buffers currently borrowed */
+	atomic_t borrowed;
+	/** Allocations served from the reserve, in total */
+	atomic_t borrows;
+	/** Allocations that found the limit reached or the reserve empty */
+	atomic_t denied;
+	/** Reserve buffers found smaller than the pool's (reported once) */
+	bool size_mismatch;
+};
+
 /**
  * @brief Packet buffer pool with auto-incrementing counter
  */
 struct weave_packet_pool {
-	struct net_buf_pool *pool; /**< Underlying net_buf pool */
-	atomic_t counter;          /**< Atomic counter for sequence numbers */
+	struct net_buf_pool *pool;            /**< Underlying net_buf pool */
+	atomic_t counter;                     /**< Atomic counter for sequence numbers */
+	struct weave_packet_ref *refs;        /**< External payloads, NULL for data pools */
+	struct weave_packet_reserve *reserve; /**< Reserve, NULL if all buffers are shared */
+	struct weave_packet_borrow *borrow;   /**< Borrowing state, NULL if not elastic */
 };
 
 /**
@@ -90,6 +172,189 @@ struct weave_packet_pool {
 		.counter = ATOMIC_INIT(0),                                                         \
 	}
 
+/**
+ * @brief Define a pool of packets referencing external data
+ *
+ * Buffers carry metadata but no data of their own; allocate them with
+ * weave_packet_alloc_ref_data().
+ *
+ * @param _name Pool variable name
+ * @param _count Number of packets that can reference external data at once
+ */
+#define WEAVE_PACKET_REF_POOL_DEFINE(_name, _count)                                                \
+	static struct weave_packet_pool _name;                                                     \
+	static void _name##_ref_destroy(struct net_buf *buf)                                       \
+	{                                                                                          \
+		weave_packet_ref_release(&_name, buf);                                             \
+	}                                                                                          \
+	static struct weave_packet_ref _name##_refs[_count];                                       \
+	NET_BUF_POOL_DEFINE(_name##_net_buf_pool, _count, 0, WEAVE_PACKET_METADATA_SIZE,           \
+			    _name##_ref_destroy);                                                  \
+	static struct weave_packet_pool _name = {                                                  \
+		.pool = &_name##_net_buf_pool,                                                     \
+		.counter = ATOMIC_INIT(0),                                                         \
+		.refs = _name##_refs,                                                              \
+	}
+
+/**
+ * @brief Define a packet buffer pool with a high-priority reserve
+ *
+ * Normal allocations leave _reserved buffers free; only
+ * weave_packet_alloc_prio() takes them, so control traffic still gets
+ * buffers while bulk traffic has exhausted the rest.
+ *
+ * @param _name Pool variable name
+ * @param _count Number of buffers
+ * @param _size Size of each buffer
+ * @param _reserved Buffers only high-priority allocations may take
+ */
+#define WEAVE_PACKET_RESERVE_POOL_DEFINE(_name, _count, _size, _reserved)                          \
+	BUILD_ASSERT((_reserved) < (_count), "Reserve must leave buffers for normal allocations"); \
+	static struct weave_packet_pool _name;                                                     \
+	static void _name##_reserve_destroy(struct net_buf *buf)                                   \
+	{                                                                                          \
+		weave_packet_reserve_release(&_name, buf);                                         \
+	}                                                                                          \
+	static uint8_t _name##_prio[_count];                                                       \
+	static struct weave_packet_reserve _name##_reserve = {                                     \
+		.normal = Z_SEM_INITIALIZER(_name##_reserve.normal, (_count) - (_reserved),        \
+					    (_count) - (_reserved)),                               \
+		.reserved = (_reserved),                                                           \
+		.prio = _name##_prio,                                                              \
+	};                                                                                         \
+	NET_BUF_POOL_DEFINE(_name##_net_buf_pool, _count, _size, WEAVE_PACKET_METADATA_SIZE,       \
+			    _name##_reserve_destroy);                                              \
+	static struct weave_packet_pool _name = {                                                  \
+		.pool = &_name##_net_buf_pool,                                                     \
+		.counter = ATOMIC_INIT(0),                                                         \
+		.reserve = &_name##_reserve,                                                       \
+	}
+
+/**
+ * @brief Define a shared reserve for elastic pools
+ *
+ * Buffers must be at least as large as those of every pool borrowing from
+ * the reserve; pools with larger buffers are denied every borrow. Nothing
+ * allocates from the reserve directly.
+ *
+ * @param _name Reserve variable name
+ * @param _count Number of buffers
+ * @param _size Size of each buffer
+ */
+#define WEAVE_PACKET_SHARED_RESERVE_DEFINE(_name, _count, _size)                                   \
+	extern struct weave_packet_shared_reserve _name;                                           \
+	static void _name##_shared_destroy(struct net_buf *buf)                                    \
+	{                                                                                          \
+		weave_packet_shared_release(&_name, buf);                                          \
+	}                                                                                          \
+	static struct weave_packet_borrow *_name##_borrowers[_count];                              \
+	NET_BUF_POOL_DEFINE(_name##_net_buf_pool, _count, _size, WEAVE_PACKET_METADATA_SIZE,       \
+			    _name##_shared_destroy);                                               \
+	struct weave_packet_shared_reserve _name = {                                               \
+		.pool = &_name##_net_buf_pool,                                                     \
+		.size = (_size),                                                                   \
+		.borrowers = _name##_borrowers,                                                    \
+	}
+
+/**
+ * @brief Declare a shared reserve defined in another file
+ *
+ * @param _name Reserve variable name
+ */
+#define WEAVE_PACKET_SHARED_RESERVE_DECLARE(_name) extern struct weave_packet_shared_reserve _name
+
+/**
+ * @brief Define a packet buffer pool that borrows from a shared reserve
+ *
+ * When its own buffers are exhausted, the pool borrows up to _limit
+ * buffers from _reserve. Borrowed buffers go back to the reserve when
+ * released.
+ *
+ * @param _name Pool variable name
+ * @param _count Number of own buffers
+ * @param _size Size of each buffer
+ * @param _reserve Shared reserve (WEAVE_PACKET_SHARED_RESERVE_DEFINE)
+ * @param _limit Buffers borrowed at most at once
+ */
+#define WEAVE_PACKET_ELASTIC_POOL_DEFINE(_name, _count, _size, _reserve, _limit)                   \
+	static struct weave_packet_borrow _name##_borrow = {                                       \
+		.reserve = &(_reserve),                                                            \
+		.size = (_size),                                                                   \
+		.limit = (_limit),                                                                 \
+	};                                                                                         \
+	NET_BUF_POOL_DEFINE(_name##_net_buf_pool, _count, _size, WEAVE_PACKET_METADATA_SIZE,       \
+			    NULL);                                                                 \
+	static struct weave_packet_pool _name = {                                                  \
+		.pool = &_name##_net_buf_pool,                                                     \
+		.counter = ATOMIC_INIT(0),                                                         \
+		.borrow = &_name##_borrow,                                                         \
+	}
+
+/**
+ * @brief Size class of a packet pool set
+ */
+struct weave_packet_pool_class {
+	struct net_buf_pool *pool; /**< Underlying net_buf pool */
+	size_t size;               /**< Data size of each buffer */
+};
+
+/**
+ * @brief Pools of several buffer sizes sharing one counter
+ */
+struct weave_packet_pool_set {
+	const struct weave_packet_pool_class *classes; /**< Size classes, ascending size */
+	size_t num_classes;                            /**< Number of size classes */
+	atomic_t counter;                              /**< Counter shared by all classes */
+};
+
+/**
+ * @brief Define the net_buf pool of one size class (used by WEAVE_PACKET_POOL_SET_DEFINE)
+ *
+ * @param _idx Class index
+ * @param _spec Size class as (count, size)
+ * @param _name Pool set name
+ */
+#define WEAVE_PACKET_POOL_CLASS_DEFINE(_idx, _spec, _name)                                         \
+	NET_BUF_POOL_DEFINE(_name##_class##_idx##_net_buf_pool,                                    \
+			    GET_ARG_N(1, __DEBRACKET _spec), GET_ARG_N(2, __DEBRACKET _spec),      \
+			    WEAVE_PACKET_METADATA_SIZE, NULL)
+
+/**
+ * @brief Static initializer for one size class of a pool set
+ *
+ * @param _idx Class index
+ * @param _spec Size class as (count, size)
+ * @param _name Pool set name
+ */
+#define WEAVE_PACKET_POOL_CLASS_INITIALIZER(_idx, _spec, _name)                                    \
+	{                                                                                          \
+		.pool = &_name##_class##_idx##_net_buf_pool,                                       \
+		.size = GET_ARG_N(2, __DEBRACKET _spec),                                           \
+	}
+
+/**
+ * @brief Define a set of packet pools with different buffer sizes
+ *
+ * Each size class is a (count, size) pair; list them by ascending size.
+ * Allocate with weave_packet_alloc_size(), which takes the smallest class
+ * that fits. Packets from all classes share one sequence counter.
+ *
+ * Example: WEAVE_PACKET_POOL_SET_DEFINE(rx_set, (16, 64), (8, 256), (2, 1024));
+ *
+ * @param _name Pool set variable name
+ * @param ... Size classes as (count, size)
+ */
+#define WEAVE_PACKET_POOL_SET_DEFINE(_name, ...)                                                   \
+	FOR_EACH_IDX_FIXED_ARG(WEAVE_PACKET_POOL_CLASS_DEFINE, (;), _name, __VA_ARGS__);           \
+	static const struct weave_packet_pool_class _name##_classes[] = {                          \
+		FOR_EACH_IDX_FIXED_ARG(WEAVE_PACKET_POOL_CLASS_INITIALIZER, (,), _name,            \
+				       __VA_ARGS__)};                                              \
+	static struct weave_packet_pool_set _name = {                                              \
+		.classes = _name##_classes,                                                        \
+		.num_classes = ARRAY_SIZE(_name##_classes),                                        \
+		.counter = ATOMIC_INIT(0),                                                         \
+	}
+
 /* ============================ Sink Context ============================ */
 
 /**
@@ -107,7 +372,7 @@ struct weave_packet_sink_ctx {
 /**
  * @brief Payload ops for net_buf with optional ID filtering
  *
- * Filtering happens in ref callback using weave_packet_sink_ctx.
+ * Filtering happens in the filter callback using weave_packet_sink_ctx.
  * If ctx->filter != WEAVE_PACKET_ID_ANY, only matching packets pass.
  */
 extern const struct weave_payload_ops weave_packet_ops;
@@ -128,6 +393,21 @@ extern const struct weave_payload_ops weave_packet_ops;
  */
 typedef void (*weave_packet_handler_t)(struct net_buf *buf, void *user_data);
 
+/**
+ * @brief Packet batch handler function type
+ *
+ * Receives several packets per call (see WEAVE_PACKET_BATCH_SINK_DEFINE).
+ *
+ * @warning The buffers are borrowed - do NOT call net_buf_unref().
+ * The framework releases all references after the handler returns.
+ *
+ * @param bufs Array of packet buffers (borrowed references)
+ * @param count Number of buffers in bufs
+ * @param user_data User data from sink definition
+ */
+typedef void (*weave_packet_batch_handler_t)(struct net_buf *const *bufs, size_t count,
+					     void *user_data);
+
 /* ============================ Source Macros ============================ */
 
 /**
@@ -174,6 +454,39 @@ typedef void (*weave_packet_handler_t)(struct net_buf *buf, void *user_data);
  */
 #define WEAVE_PACKET_SINK_DECLARE(_name) extern struct weave_sink _name
 
+/**
+ * @brief Define a packet batch sink
+ *
+ * Like WEAVE_PACKET_SINK_DEFINE, but the handler receives an array of
+ * packets drained from the queue in one call. Useful for amortising work
+ * across packets, e.g. one sendmsg() for several packets.
+ * Handler signature: void handler(struct net_buf *const *bufs, size_t count, void *user_data)
+ *
+ * Connect with WEAVE_BATCH_CONNECT(&source, name).
+ *
+ * @param _name Batch sink variable name
+ * @param _handler Batch handler function
+ * @param _queue Message queue (WV_IMMEDIATE for immediate mode, or &queue for queued)
+ * @param _max_batch Maximum packets per handler call
+ * @param _filter Packet ID filter (WV_NO_FILTER for all, or specific ID)
+ * @param _user_data User data pointer (NULL if unused)
+ */
+#define WEAVE_PACKET_BATCH_SINK_DEFINE(_name, _handler, _queue, _max_batch, _filter, _user_data)   \
+	static struct weave_packet_sink_ctx _name##_ctx = {.filter = (_filter),                    \
+							   .user_data = (_user_data)};             \
+	static void _name##_wrapper(void *const *ptrs, size_t count, void *ctx)                    \
+	{                                                                                          \
+		weave_packet_batch_handler_t handler_fn = (_handler);                              \
+		struct weave_packet_sink_ctx *sink_ctx = (struct weave_packet_sink_ctx *)ctx;      \
+		handler_fn((struct net_buf *const *)ptrs, count, sink_ctx->user_data);             \
+	}                                                                                          \
+	WEAVE_BATCH_SINK_DEFINE(_name, _name##_wrapper, (_queue), (_max_batch), &_name##_ctx)
+
+/**
+ * @brief Declare extern packet batch sink
+ */
+#define WEAVE_PACKET_BATCH_SINK_DECLARE(_name) WEAVE_BATCH_SINK_DECLARE(_name)
+
 /* ============================ Buffer Allocation ============================ */
 
 /**
@@ -205,6 +518,101 @@ struct net_buf *weave_packet_alloc(struct weave_packet_pool *pool, k_timeout_t t
 struct net_buf *weave_packet_alloc_with_id(struct weave_packet_pool *pool, uint8_t packet_id,
 					   k_timeout_t timeout);
 
+/**
+ * @brief Allocate a high-priority packet buffer
+ *
+ * Same as weave_packet_alloc_with_id(), but may also take the buffers a
+ * pool defined with WEAVE_PACKET_RESERVE_POOL_DEFINE holds in reserve.
+ * On other pools it is the same as weave_packet_alloc_with_id().
+ *
+ * @param pool Packet pool to allocate from
+ * @param packet_id Packet ID for routing/filtering
+ * @param timeout Allocation timeout
+ * @return Allocated buffer, or NULL on timeout/failure
+ */
+struct net_buf *weave_packet_alloc_prio(struct weave_packet_pool *pool, uint8_t packet_id,
+					k_timeout_t timeout);
+
+/**
+ * @brief Get the number of buffers in use by an allocation class
+ *
+ * @param pool Pool defined with WEAVE_PACKET_RESERVE_POOL_DEFINE
+ * @param prio Allocation class
+ * @return Buffers in use, or -EINVAL if the pool has no reserve
+ */
+int weave_packet_pool_used(const struct weave_packet_pool *pool, enum weave_packet_prio prio);
+
+/**
+ * @brief Release a buffer of a pool with a reserve
+ *
+ * Destroy callback of reserve pools. Do not call directly.
+ *
+ * @param pool Pool of the buffer
+ * @param buf Buffer whose last reference is gone
+ */
+void weave_packet_reserve_release(struct weave_packet_pool *pool, struct net_buf *buf);
+
+/**
+ * @brief Return a borrowed buffer to its shared reserve
+ *
+ * Destroy callback of shared reserves. Do not call directly.
+ *
+ * @param reserve Shared reserve of the buffer
+ * @param buf Buffer whose last reference is gone
+ */
+void weave_packet_shared_release(struct weave_packet_shared_reserve *reserve,
+				 struct net_buf *buf);
+
+/**
+ * @brief Allocate a packet buffer from a pool set by size
+ *
+ * Takes a buffer from the smallest class holding len bytes. When that
+ * class is exhausted, larger classes are tried in order; when all are,
+ * waits up to timeout on the smallest class that fits. Metadata is
+ * initialized as by weave_packet_alloc_with_id(), with the counter of the
+ * set.
+ *
+ * @param set Pool set to allocate from
+ * @param len Number of data bytes needed
+ * @param packet_id Packet ID for routing/filtering
+ * @param timeout Allocation timeout
+ * @return Buffer with at least len bytes of tailroom, or NULL on
+ *         timeout/failure or if no class is large enough
+ */
+struct net_buf *weave_packet_alloc_size(struct weave_packet_pool_set *set, size_t len,
+					uint8_t packet_id, k_timeout_t timeout);
+
+/**
+ * @brief Allocate a packet whose data is external memory
+ *
+ * The packet's data points at data instead of a pool buffer, so memory
+ * that is already filled (DMA buffers, const tables) is routed without a
+ * copy. Metadata is initialized as by weave_packet_alloc(). release is
+ * called once the last reference is gone; data must stay valid and
+ * unchanged until then. Handlers must not write to the packet, as usual.
+ *
+ * @param pool Pool defined with WEAVE_PACKET_REF_POOL_DEFINE
+ * @param data Payload (up to UINT16_MAX bytes)
+ * @param len Payload length
+ * @param release Called on final unref, or NULL if data outlives every packet
+ * @param user_data User data passed to release
+ * @param timeout Allocation timeout
+ * @return Packet with len bytes of data, or NULL on timeout/failure
+ */
+struct net_buf *weave_packet_alloc_ref_data(struct weave_packet_pool *pool, const void *data,
+					    size_t len, weave_packet_release_t release,
+					    void *user_data, k_timeout_t timeout);
+
+/**
+ * @brief Release a packet referencing external data
+ *
+ * Destroy callback of reference pools. Do not call directly.
+ *
+ * @param pool Reference pool of the packet
+ * @param buf Packet whose last reference is gone
+ */
+void weave_packet_ref_release(struct weave_packet_pool *pool, struct net_buf *buf);
+
 /* ============================ Send Functions ============================ */
 
 /**
@@ -246,6 +654,47 @@ static inline int weave_packet_send_ref(struct weave_source *source, struct net_
 	return weave_source_emit(source, buf, timeout);
 }
 
+/**
+ * @brief Packet fill callback for weave_packet_send_lazy()
+ *
+ * @param buf Freshly allocated packet (ID already set)
+ * @param user_data User data passed to weave_packet_send_lazy()
+ * @return 0 to send the packet, negative errno to drop it
+ */
+typedef int (*weave_packet_fill_t)(struct net_buf *buf, void *user_data);
+
+/**
+ * @brief Check whether a packet with the given ID would reach any sink
+ *
+ * Payload-free check against the connected sinks' ID filters. Costs a
+ * walk over the connections, no allocation.
+ *
+ * @param source Source to check
+ * @param packet_id Packet ID the packet would carry
+ * @return true if at least one connected sink would accept it
+ */
+bool weave_packet_would_deliver(struct weave_source *source, uint8_t packet_id);
+
+/**
+ * @brief Allocate, fill and send a packet only if some sink will accept it
+ *
+ * When no connected sink accepts packet_id (or none is connected), returns
+ * 0 without allocating or calling fill. Otherwise allocates from pool,
+ * calls fill and sends the packet (consuming the reference).
+ *
+ * @param source Source to send from
+ * @param pool Packet pool to allocate from
+ * @param packet_id Packet ID for routing/filtering
+ * @param fill Callback that writes the packet contents
+ * @param user_data User data passed to fill
+ * @param timeout Maximum time for allocation and for all deliveries
+ * @return Number of successful deliveries, -ENOMEM if allocation failed,
+ *         or negative errno (including the error returned by fill)
+ */
+int weave_packet_send_lazy(struct weave_source *source, struct weave_packet_pool *pool,
+			   uint8_t packet_id, weave_packet_fill_t fill, void *user_data,
+			   k_timeout_t timeout);
+
 /* ============================ Metadata Accessors ============================ */
 
 /**
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Packet Accounting API
+ *
+ * Weave Packet Accounting - Who holds the buffers of a pool
+ *
+ * Counts the packet references currently held, per pool and per holder.
+ * Holders are the queues of queued sinks (events waiting to be
+ * processed), the sinks of immediate handlers (while the handler runs)
+ * and named user holders that take references with weave_packet_hold().
+ * References taken with plain net_buf_ref() are not attributed.
+ */
+
+#ifndef ZEPHYR_INCLUDE_WEAVE_PACKET_ACCOUNT_H_
+#define ZEPHYR_INCLUDE_WEAVE_PACKET_ACCOUNT_H_
+
+#include <weave/packet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup weave_packet_account_apis Weave Packet Accounting APIs
+ * @ingroup os_services
+ * @{
+ */
+
+/* ============================ Type Definitions ============================ */
+
+/**
+ * @brief Kind of packet holder
+ */
+enum weave_packet_holder_kind {
+	/** Message queue of queued sinks (struct k_msgq) */
+	WEAVE_PACKET_HOLDER_QUEUE,
+	/** Immediate sink, while its handler runs (struct weave_sink) */
+	WEAVE_PACKET_HOLDER_HANDLER,
+	/** User holder (struct weave_packet_holder) */
+	WEAVE_PACKET_HOLDER_USER,
+};
+
+/**
+ * @brief Named holder of packet references taken by application code
+ */
+struct weave_packet_holder {
+	/** Name shown in accounting dumps */
+	const char *name;
+};
+
+/**
+ * @brief References held by one holder in one pool
+ */
+struct weave_packet_holding {
+	/** Pool of the referenced buffers */
+	const struct net_buf_pool *pool;
+	/** Holder, of the type given by kind */
+	const void *holder;
+	/** Kind of holder */
+	enum weave_packet_holder_kind kind;
+	/** References currently held */
+	uint32_t refs;
+};
+
+/**
+ * @brief Define a user holder
+ *
+ * @param _name Holder variable name, also its name in dumps
+ */
+#define WEAVE_PACKET_HOLDER_DEFINE(_name)                                                          \
+	struct weave_packet_holder _name = {                                                       \
+		.name = #_name,                                                                    \
+	}
+
+/* ============================ Holder Functions ============================ */
+
+/**
+ * @brief Take a packet reference on behalf of a holder
+ *
+ * net_buf_ref() that is accounted to holder.
+ *
+ * @param buf Packet
+ * @param holder User holder
+ *
+ * @return buf
+ */
+struct net_buf *weave_packet_hold(struct net_buf *buf, const struct weave_packet_holder *holder);
+
+/**
+ * @brief Release a packet reference taken with weave_packet_hold()
+ *
+ * @param buf Packet
+ * @param holder Holder passed to weave_packet_hold()
+ */
+void weave_packet_unhold(struct net_buf *buf, const struct weave_packet_holder *holder);
+
+/**
+ * @brief Count a reference taken or released by a holder
+ *
+ * Used by the packet sink ops; call it only for references the holder
+ * does not take through weave_packet_hold().
+ *
+ * @param buf Packet
+ * @param holder Holder
+ * @param kind Kind of holder
+ * @param hold true when the reference was taken, false when released
+ */
+void weave_packet_account(const struct net_buf *buf, const void *holder,
+			  enum weave_packet_holder_kind kind, bool hold);
+
+/* ============================ Reporting ============================ */
+
+/**
+ * @brief Get the references currently held
+ *
+ * @param holdings Array to fill, one entry per pool and holder
+ * @param max Number of entries in holdings
+ *
+ * @return Number of entries filled
+ */
+size_t weave_packet_holdings(struct weave_packet_holding *holdings, size_t max);
+
+/**
+ * @brief Log the references currently held, one line per pool and holder
+ */
+void weave_packet_holdings_dump(void);
+
+/**
+ * @brief Get the number of references that were not counted
+ *
+ * References are not counted while every accounting slot is in use
+ * (CONFIG_WEAVE_PACKET_ACCOUNTING_SLOTS).
+ *
+ * @return References not counted since boot
+ */
+uint32_t weave_packet_holdings_missed(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_WEAVE_PACKET_ACCOUNT_H_ */
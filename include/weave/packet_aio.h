@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Packet Asynchronous I/O API
+ *
+ * Weave Packet AIO - Transport sinks that complete writes asynchronously
+ *
+ * An AIO channel hands packets to a backend that starts a write and
+ * returns at once. The channel keeps a reference to each packet until
+ * the backend reports completion, so the sink handler never waits for
+ * the link and several writes can be in flight while the consumer
+ * thread keeps processing.
+ */
+
+#ifndef ZEPHYR_INCLUDE_WEAVE_PACKET_AIO_H_
+#define ZEPHYR_INCLUDE_WEAVE_PACKET_AIO_H_
+
+#include <weave/packet.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup weave_packet_aio_apis Weave Packet AIO APIs
+ * @ingroup os_services
+ * @{
+ */
+
+/* ============================ Type Definitions ============================ */
+
+struct weave_packet_aio;
+
+/**
+ * @brief Backend write function
+ *
+ * Starts writing buf (all fragments) and returns without waiting. The
+ * backend must call weave_packet_aio_complete() exactly once for buf,
+ * from any context, when the write finished or failed.
+ *
+ * @param aio AIO channel
+ * @param buf Packet to write (reference owned by the channel)
+ *
+ * @return 0 if the write was started, negative errno if it could not be
+ *         started (the channel then completes buf with that error)
+ */
+typedef int (*weave_packet_aio_submit_t)(struct weave_packet_aio *aio, struct net_buf *buf);
+
+/**
+ * @brief Asynchronous packet I/O channel
+ */
+struct weave_packet_aio {
+	/** Backend write function */
+	weave_packet_aio_submit_t submit;
+	/** Backend context */
+	void *backend;
+	/** Packets waiting for an in-flight slot */
+	struct net_buf **ring;
+	/** Capacity of ring */
+	uint16_t ring_size;
+	/** Oldest waiting packet */
+	uint16_t head;
+	/** Number of waiting packets */
+	uint16_t waiting;
+	/** Writes started but not completed */
+	uint16_t in_flight;
+	/** Writes the backend accepts at once */
+	uint16_t max_in_flight;
+	/** A context is starting waiting packets */
+	bool starting;
+	/** Completed writes */
+	uint32_t completed;
+	/** Writes completed with an error */
+	uint32_t errors;
+	/** Packets dropped because ring was full */
+	uint32_t dropped;
+	/** Protects the fields above */
+	struct k_spinlock lock;
+};
+
+/* ============================ Macros ============================ */
+
+/**
+ * @brief Define an AIO channel
+ *
+ * @param _name Channel variable name
+ * @param _submit Backend write function
+ * @param _backend Backend context pointer
+ * @param _max_in_flight Writes the backend accepts at once (at least 1)
+ * @param _depth Packets that can wait for a slot (at least 1)
+ */
+#define WEAVE_PACKET_AIO_DEFINE(_name, _submit, _backend, _max_in_flight, _depth)                  \
+	BUILD_ASSERT((_max_in_flight) > 0, "Backend must accept at least one write");              \
+	BUILD_ASSERT((_depth) > 0, "Channel needs room for at least one packet");                  \
+	static struct net_buf *_name##_ring[_depth];                                               \
+	struct weave_packet_aio _name = {                                                          \
+		.submit = (_submit),                                                               \
+		.backend = (_backend),                                                             \
+		.ring = _name##_ring,                                                              \
+		.ring_size = (_depth),                                                             \
+		.max_in_flight = (_max_in_flight),                                                 \
+	}
+
+/**
+ * @brief Define a packet sink that writes through an AIO channel
+ *
+ * The handler takes a reference and submits the packet; it returns
+ * without waiting for the write.
+ *
+ * @param _name Sink variable name
+ * @param _aio AIO channel variable (not pointer)
+ * @param _queue Message queue (WV_IMMEDIATE for immediate mode, or &queue for queued)
+ * @param _filter Packet ID filter (WV_NO_FILTER for all, or specific ID)
+ */
+#define WEAVE_PACKET_AIO_SINK_DEFINE(_name, _aio, _queue, _filter)                                 \
+	WEAVE_PACKET_SINK_DEFINE(_name, weave_packet_aio_handler, _queue, _filter, &(_aio))
+
+/* ============================ AIO Functions ============================ */
+
+/**
+ * @brief Write a packet through an AIO channel
+ *
+ * Queues the packet and starts it if the backend has a free slot.
+ * Consumes one reference to buf in every case.
+ *
+ * @param aio AIO channel
+ * @param buf Packet to write (caller's reference consumed)
+ *
+ * @return 0 if started or queued, -ENOBUFS if dropped, -EINVAL on
+ *         invalid arguments
+ */
+int weave_packet_aio_write(struct weave_packet_aio *aio, struct net_buf *buf);
+
+/**
+ * @brief Report completion of a backend write
+ *
+ * Releases the channel's reference to buf and starts the next waiting
+ * packet, if any. May be called from inside the backend submit function:
+ * the next packet is then started after submit returns, not from within
+ * it. ISR-safe as long as the backend submit function is.
+ *
+ * @param aio AIO channel
+ * @param buf Packet passed to the backend submit function
+ * @param result 0 on success, negative errno on failure
+ */
+void weave_packet_aio_complete(struct weave_packet_aio *aio, struct net_buf *buf, int result);
+
+/**
+ * @brief Packet handler of AIO sinks
+ *
+ * Takes a reference and calls weave_packet_aio_write(). Do not call
+ * directly.
+ *
+ * @param buf Packet (borrowed)
+ * @param user_data AIO channel
+ */
+void weave_packet_aio_handler(struct net_buf *buf, void *user_data);
+
+/* ============================ UART Backend ============================ */
+
+#if defined(CONFIG_WEAVE_PACKET_AIO_UART) || defined(__DOXYGEN__)
+#include <zephyr/drivers/uart.h>
+
+/**
+ * @brief UART backend context
+ */
+struct weave_packet_aio_uart {
+	/** UART device (async API) */
+	const struct device *dev;
+	/** Packet being written */
+	struct net_buf *buf;
+	/** Fragment being written */
+	struct net_buf *frag;
+};
+
+/**
+ * @brief Define an AIO channel writing to a UART with the async API
+ *
+ * Packet fragments are sent back to back with uart_tx(); completion is
+ * signalled from the UART_TX_DONE callback. Call
+ * weave_packet_aio_uart_init() before use.
+ *
+ * @param _name Channel variable name
+ * @param _dev UART device pointer
+ * @param _depth Packets that can wait for the UART
+ */
+#define WEAVE_PACKET_AIO_UART_DEFINE(_name, _dev, _depth)                                          \
+	static struct weave_packet_aio_uart _name##_uart = {.dev = (_dev)};                        \
+	WEAVE_PACKET_AIO_DEFINE(_name, weave_packet_aio_uart_submit, &_name##_uart, 1, _depth)
+
+/**
+ * @brief Register the UART callback of a UART AIO channel
+ *
+ * Takes over the UART's async callback.
+ *
+ * @param aio Channel defined with WEAVE_PACKET_AIO_UART_DEFINE
+ *
+ * @return 0 on success, -ENODEV if the UART is not ready, or negative
+ *         errno from uart_callback_set()
+ */
+int weave_packet_aio_uart_init(struct weave_packet_aio *aio);
+
+/**
+ * @brief Submit function of UART AIO channels. Do not call directly.
+ */
+int weave_packet_aio_uart_submit(struct weave_packet_aio *aio, struct net_buf *buf);
+
+/**
+ * @brief Handle a UART TX event of a UART AIO channel
+ *
+ * For code that shares the UART callback with the channel, e.g. to
+ * receive on the same UART. Call it for every event instead of
+ * weave_packet_aio_uart_init().
+ *
+ * @param aio Channel defined with WEAVE_PACKET_AIO_UART_DEFINE
+ * @param evt UART event
+ *
+ * @return true if evt was a TX event and has been handled
+ */
+bool weave_packet_aio_uart_event(struct weave_packet_aio *aio, const struct uart_event *evt);
+#endif /* CONFIG_WEAVE_PACKET_AIO_UART */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_WEAVE_PACKET_AIO_H_ */
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Packet COBS Framing API
+ *
+ * Weave Packet COBS - Consistent Overhead Byte Stuffing for byte streams
+ *
+ * COBS removes every zero byte from a packet at a cost of one byte per
+ * 254 bytes, so a single 0x00 can delimit frames on a serial link. The
+ * encoder reads a packet's fragment chain and writes the frame into
+ * pool fragments; the decoder is fed raw stream bytes and builds
+ * packets fragment by fragment, sending each one from a source as soon
+ * as its delimiter arrives.
+ */
+
+#ifndef ZEPHYR_INCLUDE_WEAVE_PACKET_COBS_H_
+#define ZEPHYR_INCLUDE_WEAVE_PACKET_COBS_H_
+
+#include <weave/packet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup weave_packet_cobs_apis Weave Packet COBS APIs
+ * @ingroup os_services
+ * @{
+ */
+
+/** @brief Frame delimiter */
+#define WEAVE_PACKET_COBS_DELIMITER 0x00
+
+/**
+ * @brief Worst-case frame size of a packet, including the delimiter
+ *
+ * @param _len Packet length in bytes
+ */
+#define WEAVE_PACKET_COBS_MAX_LEN(_len) ((_len) + (_len) / 254 + 2)
+
+/* ============================ Type Definitions ============================ */
+
+/**
+ * @brief Streaming COBS decoder
+ */
+struct weave_packet_cobs_decoder {
+	/** Pool for decoded packets */
+	struct weave_packet_pool *pool;
+	/** Source decoded packets are sent from */
+	struct weave_source *source;
+	/** Packet being decoded */
+	struct net_buf *buf;
+	/** Last fragment of buf */
+	struct net_buf *tail;
+	/** Code byte of the current block */
+	uint8_t code;
+	/** Data bytes left in the current block */
+	uint8_t remaining;
+	/** Skip bytes until the next delimiter */
+	bool discard;
+	/** Frames decoded and sent */
+	uint32_t frames;
+	/** Frames dropped (malformed or no buffer) */
+	uint32_t errors;
+};
+
+/* ============================ Macros ============================ */
+
+/**
+ * @brief Static initializer for a COBS decoder
+ *
+ * @param _pool Packet pool (pointer) for decoded packets
+ * @param _source Source (pointer) to send decoded packets from
+ */
+#define WEAVE_PACKET_COBS_DECODER_INITIALIZER(_pool, _source)                                      \
+	{                                                                                          \
+		.pool = (_pool),                                                                   \
+		.source = (_source),                                                               \
+	}
+
+/* ============================ COBS Functions ============================ */
+
+/**
+ * @brief Encode a packet into a COBS frame
+ *
+ * Reads all fragments of buf and writes the frame, delimiter included,
+ * into fragments allocated from pool as needed.
+ *
+ * @param buf Packet to encode (not consumed)
+ * @param pool Pool for frame fragments
+ * @param timeout Timeout for each fragment allocation
+ *
+ * @return Frame fragment chain, or NULL if buf is NULL or the pool ran out
+ */
+struct net_buf *weave_packet_cobs_encode(const struct net_buf *buf,
+					 struct weave_packet_pool *pool, k_timeout_t timeout);
+
+/**
+ * @brief Feed stream bytes to a COBS decoder
+ *
+ * Sends each completed packet from the decoder's source. Decoded bytes
+ * are copied into pool fragments, so data may be reused on return.
+ * Malformed frames and frames that do not fit the pool are dropped and
+ * counted in errors. ISR-safe (allocates and sends with K_NO_WAIT).
+ *
+ * @param dec Decoder
+ * @param data Received bytes
+ * @param len Number of bytes
+ *
+ * @return Number of packets completed, or -EINVAL on invalid arguments
+ */
+int weave_packet_cobs_decode(struct weave_packet_cobs_decoder *dec, const uint8_t *data,
+			     size_t len);
+
+/**
+ * @brief Drop the partially decoded packet
+ *
+ * Use after a link error; decoding restarts at the next delimiter.
+ *
+ * @param dec Decoder
+ */
+void weave_packet_cobs_decoder_reset(struct weave_packet_cobs_decoder *dec);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_WEAVE_PACKET_COBS_H_ */
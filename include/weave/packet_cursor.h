@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Packet Cursor API
+ *
+ * Weave Packet Cursor - Zero-copy access to fragmented packets
+ *
+ * A cursor walks a packet's fragment chain, reading and overwriting bytes
+ * and fixed-width integers wherever they fall. Values inside one fragment
+ * are accessed in place; only values that straddle a fragment boundary are
+ * assembled byte by byte. The chain itself is never modified or
+ * linearised.
+ */
+
+#ifndef ZEPHYR_INCLUDE_WEAVE_PACKET_CURSOR_H_
+#define ZEPHYR_INCLUDE_WEAVE_PACKET_CURSOR_H_
+
+#include <weave/packet.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup weave_packet_cursor_apis Weave Packet Cursor APIs
+ * @ingroup os_services
+ * @{
+ */
+
+/* ============================ Type Definitions ============================ */
+
+/**
+ * @brief Position in a packet's fragment chain
+ *
+ * The cursor holds no reference; the packet must outlive it.
+ */
+struct weave_packet_cursor {
+	/** Fragment of the next byte, NULL at the end of the packet */
+	struct net_buf *frag;
+	/** Offset of the next byte in frag's data */
+	uint16_t offset;
+};
+
+/* ============================ Cursor Functions ============================ */
+
+/**
+ * @brief Place a cursor at the first byte of a packet
+ *
+ * @param cursor Cursor to initialize
+ * @param buf Packet, or NULL for an empty cursor
+ */
+void weave_packet_cursor_init(struct weave_packet_cursor *cursor, struct net_buf *buf);
+
+/**
+ * @brief Get the number of bytes after the cursor
+ *
+ * @param cursor Cursor
+ *
+ * @return Bytes left in the packet
+ */
+size_t weave_packet_cursor_remaining(const struct weave_packet_cursor *cursor);
+
+/**
+ * @brief Get the number of bytes after the cursor in its fragment
+ *
+ * @param cursor Cursor
+ *
+ * @return Bytes that weave_packet_cursor_view() can return at once
+ */
+static inline size_t weave_packet_cursor_contiguous(const struct weave_packet_cursor *cursor)
+{
+	return cursor->frag ? cursor->frag->len - cursor->offset : 0;
+}
+
+/**
+ * @brief Get the next bytes in place
+ *
+ * Does not move the cursor.
+ *
+ * @param cursor Cursor
+ * @param len Number of bytes
+ *
+ * @return Pointer to len contiguous bytes, or NULL if they straddle a
+ *         fragment boundary or run past the end
+ */
+static inline void *weave_packet_cursor_view(const struct weave_packet_cursor *cursor, size_t len)
+{
+	if (!cursor->frag || len > weave_packet_cursor_contiguous(cursor)) {
+		return NULL;
+	}
+
+	return cursor->frag->data + cursor->offset;
+}
+
+/**
+ * @brief Move the cursor forward
+ *
+ * @param cursor Cursor
+ * @param len Number of bytes to skip
+ *
+ * @return 0 on success, -ENODATA if fewer bytes remain (cursor unchanged)
+ */
+int weave_packet_cursor_skip(struct weave_packet_cursor *cursor, size_t len);
+
+/**
+ * @brief Copy the next bytes without moving the cursor
+ *
+ * @param cursor Cursor
+ * @param dst Destination
+ * @param len Number of bytes
+ *
+ * @return 0 on success, -ENODATA if fewer bytes remain
+ */
+int weave_packet_cursor_peek(const struct weave_packet_cursor *cursor, void *dst, size_t len);
+
+/**
+ * @brief Copy the next bytes and move past them
+ *
+ * @param cursor Cursor
+ * @param dst Destination
+ * @param len Number of bytes
+ *
+ * @return 0 on success, -ENODATA if fewer bytes remain (cursor unchanged)
+ */
+int weave_packet_cursor_read(struct weave_packet_cursor *cursor, void *dst, size_t len);
+
+/**
+ * @brief Overwrite the next bytes and move past them
+ *
+ * Writes only over existing packet data; reserve space with net_buf_add()
+ * first. The packet is shared with every other holder, so write only to
+ * packets this code owns.
+ *
+ * @param cursor Cursor
+ * @param src Source
+ * @param len Number of bytes
+ *
+ * @return 0 on success, -ENODATA if fewer bytes remain (nothing written)
+ */
+int weave_packet_cursor_write(struct weave_packet_cursor *cursor, const void *src, size_t len);
+
+/**
+ * @name Fixed-width accessors
+ *
+ * Read or overwrite an integer and move past it. Return 0 on success or
+ * -ENODATA if the packet ends first, leaving cursor and value unchanged.
+ * @{
+ */
+
+/** @brief Read an 8-bit value */
+int weave_packet_cursor_read_u8(struct weave_packet_cursor *cursor, uint8_t *val);
+/** @brief Read a little-endian 16-bit value */
+int weave_packet_cursor_read_le16(struct weave_packet_cursor *cursor, uint16_t *val);
+/** @brief Read a big-endian 16-bit value */
+int weave_packet_cursor_read_be16(struct weave_packet_cursor *cursor, uint16_t *val);
+/** @brief Read a little-endian 32-bit value */
+int weave_packet_cursor_read_le32(struct weave_packet_cursor *cursor, uint32_t *val);
+/** @brief Read a big-endian 32-bit value */
+int weave_packet_cursor_read_be32(struct weave_packet_cursor *cursor, uint32_t *val);
+/** @brief Read a little-endian 64-bit value */
+int weave_packet_cursor_read_le64(struct weave_packet_cursor *cursor, uint64_t *val);
+/** @brief Read a big-endian 64-bit value */
+int weave_packet_cursor_read_be64(struct weave_packet_cursor *cursor, uint64_t *val);
+
+/** @brief Overwrite an 8-bit value */
+int weave_packet_cursor_write_u8(struct weave_packet_cursor *cursor, uint8_t val);
+/** @brief Overwrite a little-endian 16-bit value */
+int weave_packet_cursor_write_le16(struct weave_packet_cursor *cursor, uint16_t val);
+/** @brief Overwrite a big-endian 16-bit value */
+int weave_packet_cursor_write_be16(struct weave_packet_cursor *cursor, uint16_t val);
+/** @brief Overwrite a little-endian 32-bit value */
+int weave_packet_cursor_write_le32(struct weave_packet_cursor *cursor, uint32_t val);
+/** @brief Overwrite a big-endian 32-bit value */
+int weave_packet_cursor_write_be32(struct weave_packet_cursor *cursor, uint32_t val);
+/** @brief Overwrite a little-endian 64-bit value */
+int weave_packet_cursor_write_le64(struct weave_packet_cursor *cursor, uint64_t val);
+/** @brief Overwrite a big-endian 64-bit value */
+int weave_packet_cursor_write_be64(struct weave_packet_cursor *cursor, uint64_t val);
+
+/** @} */
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_WEAVE_PACKET_CURSOR_H_ */
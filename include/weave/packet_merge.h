@@ -0,0 +1,245 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Packet Merge API
+ *
+ * Weave Packet Merge - Time-ordered k-way merge of packet streams
+ *
+ * A merge stage has several input sinks and one output source. Packets
+ * are buffered per input and sent from the source in metadata timestamp
+ * order, so a fusion consumer connected to several sensors sees samples
+ * in sample order instead of arrival order.
+ *
+ * The oldest buffered packet is sent as soon as every input has a
+ * packet buffered, or once it is older than the lateness bound, so a
+ * slow or silent input delays the output by at most that bound. Each
+ * input must deliver its own packets in timestamp order. Packets older
+ * than the last one sent are dropped and counted as late.
+ *
+ * Buffered inputs are kept in a binary min-heap on their oldest
+ * timestamp: each packet costs O(log k) for k inputs, and memory is
+ * bounded by the per-input depth.
+ */
+
+#ifndef ZEPHYR_INCLUDE_WEAVE_PACKET_MERGE_H_
+#define ZEPHYR_INCLUDE_WEAVE_PACKET_MERGE_H_
+
+#include <weave/packet.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup weave_packet_merge_apis Weave Packet Merge APIs
+ * @ingroup os_services
+ * @{
+ */
+
+/* ============================ Type Definitions ============================ */
+
+/**
+ * @brief Packet timestamp compared by the merge
+ *
+ * Cycles with CONFIG_WEAVE_PACKET_TIMESTAMP_HIRES, ticks otherwise.
+ */
+#ifdef CONFIG_WEAVE_PACKET_TIMESTAMP_HIRES
+typedef uint64_t weave_packet_merge_time_t;
+#else
+typedef uint32_t weave_packet_merge_time_t;
+#endif
+
+struct weave_packet_merge;
+
+/**
+ * @brief Merge input - packets buffered from one stream
+ */
+struct weave_packet_merge_input {
+	/** Merge this input belongs to */
+	struct weave_packet_merge *merge;
+	/** Buffered packets, oldest first */
+	struct net_buf **ring;
+	/** Oldest buffered packet */
+	uint16_t head;
+	/** Number of buffered packets */
+	uint16_t count;
+	/** Timestamp of the newest buffered packet */
+	weave_packet_merge_time_t newest;
+	/** Index of this input */
+	uint8_t index;
+};
+
+/**
+ * @brief Heap entry - an input with buffered packets
+ */
+struct weave_packet_merge_entry {
+	/** Timestamp of the input's oldest buffered packet */
+	weave_packet_merge_time_t stamp;
+	/** Input index */
+	uint8_t input;
+};
+
+/**
+ * @brief Time-ordered merge stage
+ */
+struct weave_packet_merge {
+	/** Source merged packets are sent from */
+	struct weave_source source;
+	/** Inputs */
+	struct weave_packet_merge_input *inputs;
+	/** Min-heap of inputs with buffered packets */
+	struct weave_packet_merge_entry *heap;
+	/** Number of inputs */
+	uint8_t num_inputs;
+	/** Number of entries in heap */
+	uint8_t heap_len;
+	/** Packets buffered per input */
+	uint16_t depth;
+	/** Longest wait for slower inputs (microseconds) */
+	uint32_t lateness_us;
+	/** Timestamp of the last packet sent */
+	weave_packet_merge_time_t last;
+	/** A packet was sent, last is valid */
+	bool started;
+	/** Serializes inputs and the lateness flush */
+	struct k_mutex lock;
+	/** Sends packets whose lateness bound expired */
+	struct k_work_delayable flush;
+	/** Packets sent */
+	uint32_t merged;
+	/** Packets dropped because they arrived after newer ones were sent */
+	uint32_t late;
+	/** Packets sent without waiting for slower inputs because an input was full */
+	uint32_t forced;
+};
+
+/* ============================ Macros ============================ */
+
+/**
+ * @brief Initializer of merge input _idx (internal, used by WEAVE_PACKET_MERGE_DEFINE)
+ *
+ * @param _idx Input index
+ * @param _name Merge variable name
+ * @param _depth Packets buffered per input
+ */
+#define WEAVE_PACKET_MERGE_INPUT_INITIALIZER(_idx, _name, _depth)                                  \
+	{                                                                                          \
+		.merge = &(_name),                                                                 \
+		.ring = &_name##_ring[(_idx) * (_depth)],                                          \
+		.index = (_idx),                                                                   \
+	}
+
+/**
+ * @brief Define the sink of merge input _idx (internal, used by WEAVE_PACKET_MERGE_DEFINE)
+ *
+ * @param _idx Input index
+ * @param _name Merge variable name
+ * @param _queue Message queue of the input sinks
+ */
+#define WEAVE_PACKET_MERGE_SINK_DEFINE(_idx, _name, _queue)                                        \
+	WEAVE_PACKET_SINK_DEFINE(_name##_input##_idx, weave_packet_merge_handler, _queue,          \
+				 WV_NO_FILTER, &_name##_inputs[_idx])
+
+/**
+ * @brief Define a time-ordered merge stage
+ *
+ * Defines the merge and one packet sink per input, named
+ * _name_input0 to _name_input<_num_inputs - 1>. Connect each stream to
+ * its input sink and consumers to the merge's source:
+ *
+ * @code
+ * WEAVE_PACKET_MERGE_DEFINE(fusion, 2, 4, 2000, &fusion_msgq);
+ * WEAVE_CONNECT(&sensor1_source, &fusion_input0);
+ * WEAVE_CONNECT(&sensor2_source, &fusion_input1);
+ * WEAVE_CONNECT(&fusion.source, &fusion_sink);
+ * @endcode
+ *
+ * Input sinks take the merge's mutex, so they must run in thread
+ * context: queue them when a stream is sent from an ISR.
+ *
+ * @param _name Merge variable name
+ * @param _num_inputs Number of inputs (integer literal, 1 to 255)
+ * @param _depth Packets buffered per input
+ * @param _lateness_us Longest wait for slower inputs (microseconds)
+ * @param _queue Message queue of the input sinks (WV_IMMEDIATE or &queue)
+ */
+#define WEAVE_PACKET_MERGE_DEFINE(_name, _num_inputs, _depth, _lateness_us, _queue)                \
+	BUILD_ASSERT(IN_RANGE(_num_inputs, 1, UINT8_MAX), "Merge needs 1 to 255 inputs");          \
+	BUILD_ASSERT(IN_RANGE(_depth, 1, UINT16_MAX), "Merge depth out of range");                 \
+	extern struct weave_packet_merge _name;                                                    \
+	static struct net_buf *_name##_ring[(_num_inputs) * (_depth)];                             \
+	static struct weave_packet_merge_entry _name##_heap[_num_inputs];                          \
+	static struct weave_packet_merge_input _name##_inputs[] = {                                \
+		LISTIFY(_num_inputs, WEAVE_PACKET_MERGE_INPUT_INITIALIZER, (,), _name, _depth)};   \
+	LISTIFY(_num_inputs, WEAVE_PACKET_MERGE_SINK_DEFINE, (;), _name, _queue);                  \
+	struct weave_packet_merge _name = {                                                        \
+		.source = WEAVE_SOURCE_INITIALIZER(_name.source, &weave_packet_ops),               \
+		.inputs = _name##_inputs,                                                          \
+		.heap = _name##_heap,                                                              \
+		.num_inputs = (_num_inputs),                                                       \
+		.depth = (_depth),                                                                 \
+		.lateness_us = (_lateness_us),                                                     \
+		.lock = Z_MUTEX_INITIALIZER(_name.lock),                                           \
+		.flush = Z_WORK_DELAYABLE_INITIALIZER(weave_packet_merge_flush_handler),           \
+	}
+
+/**
+ * @brief Declare an extern merge stage
+ */
+#define WEAVE_PACKET_MERGE_DECLARE(_name) extern struct weave_packet_merge _name
+
+/* ============================ Merge Functions ============================ */
+
+/**
+ * @brief Input sink handler (used by WEAVE_PACKET_MERGE_DEFINE)
+ *
+ * Buffers buf and sends every packet that is due. Drops buf if it is
+ * older than a packet already sent. When the input is full, its oldest
+ * packets are sent first even if slower inputs are behind.
+ *
+ * @param buf Packet (borrowed reference)
+ * @param user_data Merge input
+ */
+void weave_packet_merge_handler(struct net_buf *buf, void *user_data);
+
+/**
+ * @brief Lateness flush work handler (used by WEAVE_PACKET_MERGE_DEFINE)
+ *
+ * @param work Flush work of a merge stage
+ */
+void weave_packet_merge_flush_handler(struct k_work *work);
+
+/**
+ * @brief Send all buffered packets in timestamp order
+ *
+ * Does not wait for slower inputs, e.g. at the end of a stream.
+ *
+ * @param merge Merge stage
+ *
+ * @return Number of packets sent, or -EINVAL if merge is NULL
+ */
+int weave_packet_merge_flush(struct weave_packet_merge *merge);
+
+/**
+ * @brief Get the number of buffered packets
+ *
+ * @param merge Merge stage
+ *
+ * @return Packets buffered over all inputs, or -EINVAL if merge is NULL
+ */
+int weave_packet_merge_pending(struct weave_packet_merge *merge);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_WEAVE_PACKET_MERGE_H_ */
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Packet Shared Memory Transport API
+ *
+ * Weave Packet SHM - Route packets between two native_sim processes
+ *
+ * Two processes map one POSIX shared memory object holding a
+ * single-producer/single-consumer ring per direction. The transport
+ * sink copies each packet into the TX ring once and rings a futex
+ * doorbell; the receiver sends each record as a zero-copy slice that
+ * points into the RX ring, and the record's space is reused only after
+ * every holder has released the slice.
+ */
+
+#ifndef ZEPHYR_INCLUDE_WEAVE_PACKET_SHM_H_
+#define ZEPHYR_INCLUDE_WEAVE_PACKET_SHM_H_
+
+#include <weave/packet.h>
+#include <zephyr/kernel.h>
+#include <zephyr/spinlock.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup weave_packet_shm_apis Weave Packet SHM APIs
+ * @ingroup os_services
+ * @{
+ */
+
+/* ============================ Type Definitions ============================ */
+
+/**
+ * @brief One direction of a shared memory link (lives in shared memory)
+ */
+struct weave_packet_shm_ring {
+	/** Producer position in bytes (free running) */
+	atomic_t head;
+	/** Start of the oldest record not yet released (free running) */
+	atomic_t tail;
+	/** Futex word, incremented after each write */
+	uint32_t doorbell;
+	/** Non-zero while the consumer sleeps on doorbell */
+	uint32_t sleeping;
+	/** Size of data in bytes (power of two) */
+	uint32_t size;
+	/** Record storage */
+	uint8_t data[];
+};
+
+/**
+ * @brief Shared memory packet transport
+ *
+ * The counters are updated from the sink and the receiving thread alike;
+ * read them with atomic_get().
+ */
+struct weave_packet_shm {
+	/** Shared memory object name */
+	const char *name;
+	/** Ring data bytes per direction */
+	uint32_t ring_size;
+	/** 0 creates the shared memory object, 1 attaches to it */
+	uint8_t side;
+	/** Ring this side writes */
+	struct weave_packet_shm_ring *tx;
+	/** Ring this side reads */
+	struct weave_packet_shm_ring *rx;
+	/** Pool of slice buffers pointing into rx */
+	struct net_buf_pool *slice_pool;
+	/** Ring position of the record behind each slice, by net_buf_id() */
+	uint32_t *slice_pos;
+	/** Source received packets are sent from */
+	struct weave_source *source;
+	/** Next RX record to hand out */
+	uint32_t read;
+	/** Serializes writers of tx */
+	struct k_spinlock tx_lock;
+	/** Protects read and the release of rx records */
+	struct k_spinlock rx_lock;
+	/** Packets written to tx */
+	atomic_t tx_packets;
+	/** Packets dropped because tx was full or the packet too long */
+	atomic_t tx_dropped;
+	/** Packets received from rx */
+	atomic_t rx_packets;
+};
+
+/* ============================ Macros ============================ */
+
+/**
+ * @brief Define a shared memory packet transport
+ *
+ * Defines the transport (_name), the sink of packets to send
+ * (_name##_sink) and the source of received packets (_name##_source).
+ * Both processes use the same _shm_name and _ring_size with opposite
+ * _side. Call weave_packet_shm_init() before use.
+ *
+ * @param _name Transport variable name
+ * @param _shm_name Shared memory object name (e.g. "/weave_link")
+ * @param _side 0 to create the shared memory object, 1 to attach
+ * @param _ring_size Ring data bytes per direction (power of two)
+ * @param _slices Received packets that can be held at once
+ */
+#define WEAVE_PACKET_SHM_DEFINE(_name, _shm_name, _side, _ring_size, _slices)                      \
+	BUILD_ASSERT(IS_POWER_OF_TWO(_ring_size), "Ring size must be a power of two");             \
+	BUILD_ASSERT((_side) == 0 || (_side) == 1, "Side must be 0 or 1");                         \
+	extern struct weave_packet_shm _name;                                                      \
+	static void _name##_slice_destroy(struct net_buf *buf)                                     \
+	{                                                                                          \
+		weave_packet_shm_slice_release(&_name, buf);                                       \
+	}                                                                                          \
+	static uint32_t _name##_slice_pos[_slices];                                                \
+	NET_BUF_POOL_DEFINE(_name##_slice_pool, _slices, 0, WEAVE_PACKET_METADATA_SIZE,            \
+			    _name##_slice_destroy);                                                \
+	WEAVE_PACKET_SOURCE_DEFINE(_name##_source);                                                \
+	struct weave_packet_shm _name = {                                                          \
+		.name = (_shm_name),                                                               \
+		.ring_size = (_ring_size),                                                         \
+		.side = (_side),                                                                   \
+		.slice_pool = &_name##_slice_pool,                                                 \
+		.slice_pos = _name##_slice_pos,                                                    \
+		.source = &_name##_source,                                                         \
+	};                                                                                         \
+	WEAVE_PACKET_SINK_DEFINE(_name##_sink, weave_packet_shm_handler, WV_IMMEDIATE,             \
+				 WV_NO_FILTER, &_name)
+
+/**
+ * @brief Declare a shared memory packet transport defined elsewhere
+ *
+ * @param _name Transport variable name
+ */
+#define WEAVE_PACKET_SHM_DECLARE(_name)                                                            \
+	extern struct weave_packet_shm _name;                                                      \
+	WEAVE_PACKET_SOURCE_DECLARE(_name##_source);                                               \
+	WEAVE_PACKET_SINK_DECLARE(_name##_sink)
+
+/* ============================ Transport Functions ============================ */
+
+/**
+ * @brief Map the shared memory object and set up the rings
+ *
+ * Side 0 creates a fresh object. Side 1 waits for side 0 for up to
+ * timeout.
+ *
+ * @param shm Transport
+ * @param timeout Time side 1 waits for side 0
+ *
+ * @return 0 on success, -EINVAL on invalid arguments, -EAGAIN if side 0
+ *         did not appear in time, or negative errno from the host
+ */
+int weave_packet_shm_init(struct weave_packet_shm *shm, k_timeout_t timeout);
+
+/**
+ * @brief Receive packets from the RX ring
+ *
+ * Sends every available record from the transport source as a slice
+ * and waits up to timeout if there is none, or if every slice is still
+ * held. Call from the thread that serves the link.
+ *
+ * @param shm Transport
+ * @param timeout Time to wait for the first record
+ *
+ * @return Number of packets received, -EAGAIN on timeout, or -EINVAL on
+ *         invalid arguments or before weave_packet_shm_init()
+ */
+int weave_packet_shm_receive(struct weave_packet_shm *shm, k_timeout_t timeout);
+
+/**
+ * @brief Packet handler of shared memory transport sinks
+ *
+ * Copies the packet into the TX ring. Do not call directly.
+ *
+ * @param buf Packet (borrowed)
+ * @param user_data Transport
+ */
+void weave_packet_shm_handler(struct net_buf *buf, void *user_data);
+
+/**
+ * @brief Release the ring space of a slice
+ *
+ * Destroy callback of the slice pool. Do not call directly.
+ *
+ * @param shm Transport
+ * @param buf Slice
+ */
+void weave_packet_shm_slice_release(struct weave_packet_shm *shm, struct net_buf *buf);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_WEAVE_PACKET_SHM_H_ */
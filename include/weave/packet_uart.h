@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Packet UART Transport API
+ *
+ * Weave Packet UART - Route packets over a serial link
+ *
+ * A UART transport is a packet sink that sends each packet as a COBS
+ * frame and a packet source that sends each frame received, so serial
+ * links wire up like any other source/sink pair. Both directions use
+ * the async UART API: frames are written through a UART AIO channel,
+ * and reception runs double-buffered with RX buffers taken from and
+ * returned to a weave packet pool.
+ */
+
+#ifndef ZEPHYR_INCLUDE_WEAVE_PACKET_UART_H_
+#define ZEPHYR_INCLUDE_WEAVE_PACKET_UART_H_
+
+#include <weave/packet.h>
+#include <weave/packet_aio.h>
+#include <weave/packet_cobs.h>
+#include <zephyr/drivers/uart.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup weave_packet_uart_apis Weave Packet UART APIs
+ * @ingroup os_services
+ * @{
+ */
+
+/* ============================ Type Definitions ============================ */
+
+/**
+ * @brief UART packet transport
+ */
+struct weave_packet_uart {
+	/** UART device (async API) */
+	const struct device *dev;
+	/** TX channel writing frames to dev */
+	struct weave_packet_aio *aio;
+	/** Pool for TX frames */
+	struct weave_packet_pool *tx_pool;
+	/** Pool for RX buffers and received packets */
+	struct weave_packet_pool *rx_pool;
+	/** Decoder of the RX stream */
+	struct weave_packet_cobs_decoder decoder;
+	/** RX buffers handed to the driver */
+	struct net_buf *rx_bufs[2];
+	/** Packets not sent because the TX pool ran out */
+	atomic_t tx_dropped;
+	/** Times RX was stopped by a line error */
+	atomic_t rx_stopped;
+	/** Failed attempts to restart RX after the driver disabled it */
+	atomic_t rx_restart_failed;
+	/** Retries a failed RX restart */
+	struct k_work_delayable rx_restart;
+};
+
+/* ============================ Macros ============================ */
+
+/**
+ * @brief Define a UART packet transport
+ *
+ * Defines the transport (_name), the sink of packets to send
+ * (_name##_sink) and the source of received packets (_name##_source).
+ * Call weave_packet_uart_init() before use.
+ *
+ * rx_pool buffers serve both as RX buffers of the driver and as
+ * fragments of received packets; it needs at least three buffers.
+ *
+ * @param _name Transport variable name
+ * @param _dev UART device pointer
+ * @param _queue Message queue of the sink (WV_IMMEDIATE, or &queue)
+ * @param _rx_pool Packet pool (pointer) for reception
+ * @param _tx_pool Packet pool (pointer) for TX frames
+ * @param _tx_depth Frames that can wait for the UART
+ */
+#define WEAVE_PACKET_UART_DEFINE(_name, _dev, _queue, _rx_pool, _tx_pool, _tx_depth)               \
+	WEAVE_PACKET_AIO_UART_DEFINE(_name##_aio, _dev, _tx_depth);                                \
+	WEAVE_PACKET_SOURCE_DEFINE(_name##_source);                                                \
+	struct weave_packet_uart _name = {                                                         \
+		.dev = (_dev),                                                                     \
+		.aio = &_name##_aio,                                                               \
+		.tx_pool = (_tx_pool),                                                             \
+		.rx_pool = (_rx_pool),                                                             \
+		.decoder = WEAVE_PACKET_COBS_DECODER_INITIALIZER(_rx_pool, &_name##_source),       \
+		.rx_restart = Z_WORK_DELAYABLE_INITIALIZER(weave_packet_uart_rx_restart_handler),  \
+	};                                                                                         \
+	WEAVE_PACKET_SINK_DEFINE(_name##_sink, weave_packet_uart_handler, _queue, WV_NO_FILTER,    \
+				 &_name)
+
+/**
+ * @brief Declare a UART packet transport defined elsewhere
+ *
+ * @param _name Transport variable name
+ */
+#define WEAVE_PACKET_UART_DECLARE(_name)                                                           \
+	extern struct weave_packet_uart _name;                                                     \
+	WEAVE_PACKET_SOURCE_DECLARE(_name##_source);                                               \
+	WEAVE_PACKET_SINK_DECLARE(_name##_sink)
+
+/* ============================ Transport Functions ============================ */
+
+/**
+ * @brief Take over the UART and start receiving
+ *
+ * @param uart Transport
+ *
+ * @return 0 on success, -EINVAL on invalid arguments, -ENODEV if the
+ *         UART is not ready, -ENOMEM if no RX buffer is available, or
+ *         negative errno from the UART driver
+ */
+int weave_packet_uart_init(struct weave_packet_uart *uart);
+
+/**
+ * @brief Packet handler of UART transport sinks
+ *
+ * Encodes the packet into a frame and writes it. Do not call directly.
+ *
+ * @param buf Packet (borrowed)
+ * @param user_data Transport
+ */
+void weave_packet_uart_handler(struct net_buf *buf, void *user_data);
+
+/**
+ * @brief RX restart retry work handler (used by WEAVE_PACKET_UART_DEFINE)
+ *
+ * @param work Restart work of a UART transport
+ */
+void weave_packet_uart_rx_restart_handler(struct k_work *work);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_WEAVE_PACKET_UART_H_ */
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Packet UDP Transport API
+ *
+ * Weave Packet UDP - One packet per datagram, for loss-tolerant traffic
+ *
+ * Each packet sent to the transport sink becomes one datagram, its
+ * fragments gathered by sendmsg(). Each datagram received is read into a
+ * pool buffer and sent from the transport source. Peers are kept in a
+ * small table and identified by the packet's client_id: received packets
+ * carry the client_id of their sender, and packets sent with a client_id
+ * go to that peer, or to every peer with client_id 0.
+ */
+
+#ifndef ZEPHYR_INCLUDE_WEAVE_PACKET_UDP_H_
+#define ZEPHYR_INCLUDE_WEAVE_PACKET_UDP_H_
+
+#include <weave/packet.h>
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/spinlock.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup weave_packet_udp_apis Weave Packet UDP APIs
+ * @ingroup os_services
+ * @{
+ */
+
+/** client_id of packets sent to every peer */
+#define WEAVE_PACKET_UDP_ALL_PEERS 0
+
+/* ============================ Type Definitions ============================ */
+
+/**
+ * @brief Peer of a UDP transport
+ */
+struct weave_packet_udp_peer {
+	/** Peer address */
+	struct sockaddr addr;
+	/** Length of addr */
+	socklen_t addrlen;
+};
+
+/**
+ * @brief UDP packet transport
+ *
+ * The counters are updated from the sink and the receiving thread alike;
+ * read them with atomic_get().
+ */
+struct weave_packet_udp {
+	/** Socket, or -1 before weave_packet_udp_open() */
+	int sock;
+	/** Pool for received datagrams */
+	struct weave_packet_pool *rx_pool;
+	/** Source received packets are sent from */
+	struct weave_source *source;
+	/** Peer table; peer i has client_id i + 1 */
+	struct weave_packet_udp_peer *peers;
+	/** Size of the peer table */
+	uint8_t max_peers;
+	/** Peers in the table */
+	uint8_t num_peers;
+	/** Protects the peer table */
+	struct k_spinlock lock;
+	/** Datagrams received and sent from source */
+	atomic_t rx_packets;
+	/** Calls of weave_packet_udp_receive() that read datagrams */
+	atomic_t rx_batches;
+	/** Datagrams dropped: no buffer, truncated, or peer table full */
+	atomic_t rx_dropped;
+	/** Datagrams sent */
+	atomic_t tx_packets;
+	/** Packets not sent: unknown client_id or socket error */
+	atomic_t tx_dropped;
+};
+
+/* ============================ Macros ============================ */
+
+/**
+ * @brief Define a UDP packet transport
+ *
+ * Defines the transport (_name), the batch sink of packets to send
+ * (_name##_sink, connect with WEAVE_BATCH_CONNECT) and the source of
+ * received packets (_name##_source). Call weave_packet_udp_open() before
+ * use.
+ *
+ * A queued sink takes up to CONFIG_WEAVE_PACKET_UDP_TX_BATCH packets per
+ * handler call, so the serving thread sends a burst per wake-up.
+ *
+ * Buffers of _rx_pool must fit the largest datagram expected; longer
+ * datagrams are dropped.
+ *
+ * @param _name Transport variable name
+ * @param _queue Message queue of the sink (WV_IMMEDIATE, or &queue)
+ * @param _rx_pool Packet pool (pointer) for reception
+ * @param _max_peers Peers the transport can tell apart (1 to 255)
+ */
+#define WEAVE_PACKET_UDP_DEFINE(_name, _queue, _rx_pool, _max_peers)                               \
+	BUILD_ASSERT((_max_peers) > 0 && (_max_peers) <= UINT8_MAX, "Invalid peer count");         \
+	static struct weave_packet_udp_peer _name##_peers[_max_peers];                             \
+	WEAVE_PACKET_SOURCE_DEFINE(_name##_source);                                                \
+	struct weave_packet_udp _name = {                                                          \
+		.sock = -1,                                                                        \
+		.rx_pool = (_rx_pool),                                                             \
+		.source = &_name##_source,                                                         \
+		.peers = _name##_peers,                                                            \
+		.max_peers = (_max_peers),                                                         \
+	};                                                                                         \
+	WEAVE_PACKET_BATCH_SINK_DEFINE(_name##_sink, weave_packet_udp_handler, _queue,             \
+				       CONFIG_WEAVE_PACKET_UDP_TX_BATCH, WV_NO_FILTER, &_name)
+
+/**
+ * @brief Declare a UDP packet transport defined elsewhere
+ *
+ * @param _name Transport variable name
+ */
+#define WEAVE_PACKET_UDP_DECLARE(_name)                                                            \
+	extern struct weave_packet_udp _name;                                                      \
+	WEAVE_PACKET_SOURCE_DECLARE(_name##_source);                                               \
+	WEAVE_BATCH_SINK_DECLARE(_name##_sink)
+
+/* ============================ Transport Functions ============================ */
+
+/**
+ * @brief Create the socket and bind it to a local address
+ *
+ * @param udp Transport
+ * @param local Local address (port 0 for any port)
+ * @param addrlen Length of local
+ *
+ * @return 0 on success, -EINVAL on invalid arguments, -EALREADY if the
+ *         transport is open, or negative errno from the socket layer
+ */
+int weave_packet_udp_open(struct weave_packet_udp *udp, const struct sockaddr *local,
+			  socklen_t addrlen);
+
+/**
+ * @brief Close the socket and forget all peers
+ *
+ * @param udp Transport
+ */
+void weave_packet_udp_close(struct weave_packet_udp *udp);
+
+/**
+ * @brief Add a peer to send to before it has sent anything
+ *
+ * @param udp Transport
+ * @param addr Peer address
+ * @param addrlen Length of addr
+ *
+ * @return client_id of the peer (also if already known), -EINVAL on
+ *         invalid arguments, or -ENOMEM if the peer table is full
+ */
+int weave_packet_udp_add_peer(struct weave_packet_udp *udp, const struct sockaddr *addr,
+			      socklen_t addrlen);
+
+/**
+ * @brief Receive waiting datagrams
+ *
+ * Reads up to CONFIG_WEAVE_PACKET_UDP_RX_BATCH datagrams without
+ * blocking and sends each from the transport source, tagged with the
+ * client_id of its sender. Datagrams from new senders add them to the
+ * peer table. Call when the socket polls readable, e.g. from the
+ * thread that serves the sink queue with weave_poll().
+ *
+ * @param udp Transport
+ *
+ * @return Number of datagrams read (0 if none was waiting), -EINVAL if
+ *         the transport is not open, or negative errno from the socket
+ *         layer
+ */
+int weave_packet_udp_receive(struct weave_packet_udp *udp);
+
+/**
+ * @brief Batch handler of UDP transport sinks
+ *
+ * Sends each packet as one datagram to the peer of its client_id. Do not
+ * call directly.
+ *
+ * @param bufs Packets (borrowed)
+ * @param count Number of packets
+ * @param user_data Transport
+ */
+void weave_packet_udp_handler(struct net_buf *const *bufs, size_t count, void *user_data);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_WEAVE_PACKET_UDP_H_ */
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Packet Wire Header API
+ *
+ * Weave Packet Wire - Compact variable-length header for packet metadata
+ *
+ * A wire header carries a packet's payload length and, selected by flag
+ * bits, its packet ID, client ID, counter and timestamp:
+ *
+ *   flags (1) | length (varint) | [packet_id (1)] | [client_id (1)]
+ *             | [counter (varint)] | [timestamp_ns (varint)]
+ *
+ * Counter and timestamp are sent as zigzag deltas to the previous header
+ * of the same connection, so a header for a small payload is typically
+ * 5-9 bytes. The first header after weave_packet_wire_reset() has
+ * WEAVE_PACKET_WIRE_F_SYNC set and carries both absolutely. Decoding
+ * reads the header in place; the payload follows it unchanged.
+ */
+
+#ifndef ZEPHYR_INCLUDE_WEAVE_PACKET_WIRE_H_
+#define ZEPHYR_INCLUDE_WEAVE_PACKET_WIRE_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup weave_packet_wire_apis Weave Packet Wire APIs
+ * @ingroup os_services
+ * @{
+ */
+
+/** packet_id field present */
+#define WEAVE_PACKET_WIRE_F_ID        BIT(0)
+/** client_id field present */
+#define WEAVE_PACKET_WIRE_F_CLIENT_ID BIT(1)
+/** counter field present */
+#define WEAVE_PACKET_WIRE_F_COUNTER   BIT(2)
+/** timestamp field present */
+#define WEAVE_PACKET_WIRE_F_TIMESTAMP BIT(3)
+/** Counter and timestamp are absolute and restart the deltas */
+#define WEAVE_PACKET_WIRE_F_SYNC      BIT(4)
+
+/** Field flags a header may select */
+#define WEAVE_PACKET_WIRE_F_FIELDS                                                                 \
+	(WEAVE_PACKET_WIRE_F_ID | WEAVE_PACKET_WIRE_F_CLIENT_ID | WEAVE_PACKET_WIRE_F_COUNTER |    \
+	 WEAVE_PACKET_WIRE_F_TIMESTAMP)
+
+/** Largest encoded header in bytes */
+#define WEAVE_PACKET_WIRE_HDR_MAX 19
+
+/* ============================ Type Definitions ============================ */
+
+/**
+ * @brief Decoded wire header
+ */
+struct weave_packet_wire_hdr {
+	/** WEAVE_PACKET_WIRE_F_* fields present */
+	uint8_t flags;
+	/** Packet ID */
+	uint8_t packet_id;
+	/** Client ID */
+	uint8_t client_id;
+	/** Payload length in bytes, following the header */
+	uint16_t len;
+	/** Packet counter */
+	uint16_t counter;
+	/** Timestamp in nanoseconds */
+	uint64_t timestamp_ns;
+};
+
+/**
+ * @brief Delta state of one direction of a connection
+ *
+ * The encoder and the decoder of a connection each keep one; reset both
+ * when the connection starts.
+ */
+struct weave_packet_wire_ctx {
+	/** Counter of the previous header */
+	uint16_t counter;
+	/** Timestamp of the previous header */
+	uint64_t timestamp_ns;
+	/** Deltas have a base */
+	bool synced;
+};
+
+/* ============================ Wire Functions ============================ */
+
+/**
+ * @brief Restart the deltas of a connection
+ *
+ * The next header encoded is a sync header. A decoder that is reset
+ * cannot resolve counter and timestamp deltas until it sees one.
+ *
+ * @param ctx Delta state
+ */
+static inline void weave_packet_wire_reset(struct weave_packet_wire_ctx *ctx)
+{
+	ctx->synced = false;
+}
+
+/**
+ * @brief Encode a header
+ *
+ * Encodes the fields selected by hdr->flags; WEAVE_PACKET_WIRE_F_SYNC
+ * is added as needed.
+ *
+ * @param ctx Delta state of the connection
+ * @param hdr Header to encode
+ * @param out Output buffer (WEAVE_PACKET_WIRE_HDR_MAX bytes always fit)
+ * @param size Size of out
+ *
+ * @return Header length in bytes, -EINVAL on invalid arguments, or
+ *         -ENOMEM if out is too small
+ */
+int weave_packet_wire_encode(struct weave_packet_wire_ctx *ctx,
+			     const struct weave_packet_wire_hdr *hdr, uint8_t *out, size_t size);
+
+/**
+ * @brief Decode a header in place
+ *
+ * The payload starts at data + return value and is hdr->len bytes long.
+ * ctx is only updated when a complete header was decoded. Counter and
+ * timestamp deltas received before the first sync header cannot be
+ * resolved; their flags are cleared in hdr.
+ *
+ * @param ctx Delta state of the connection
+ * @param data Received bytes, starting with the header
+ * @param len Number of bytes in data
+ * @param hdr Decoded header
+ *
+ * @return Header length in bytes, -EAGAIN if data ends inside the header,
+ *         or -EINVAL on invalid arguments or a malformed header
+ */
+int weave_packet_wire_decode(struct weave_packet_wire_ctx *ctx, const uint8_t *data, size_t len,
+			     struct weave_packet_wire_hdr *hdr);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_WEAVE_PACKET_WIRE_H_ */
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Poll API
+ *
+ * Weave Poll - Wait on weave queues and socket file descriptors together
+ *
+ * A pollable queue owns an eventfd that producers signal when they put
+ * an event into an idle queue. weave_poll() adds these eventfds to the
+ * caller's socket fds, so a single thread can block in one zsock_poll()
+ * call for both network I/O and weave events.
+ */
+
+#ifndef ZEPHYR_INCLUDE_WEAVE_POLL_H_
+#define ZEPHYR_INCLUDE_WEAVE_POLL_H_
+
+#include <weave/core.h>
+#include <zephyr/net/socket.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup weave_poll_apis Weave Poll APIs
+ * @ingroup os_services
+ * @{
+ */
+
+/* ============================ Type Definitions ============================ */
+
+/**
+ * @brief Pollable queue
+ */
+struct weave_poll_queue {
+	/** Message queue */
+	struct k_msgq *queue;
+	/** Eventfd signalled on enqueue (-1 until the first weave_poll()) */
+	int fd;
+	/** Non-zero while a signal is pending on fd */
+	atomic_t signalled;
+};
+
+/* ============================ Macros ============================ */
+
+/**
+ * @brief Define a message queue that can be waited on with weave_poll()
+ *
+ * Also defines the pollable queue (_name##_poll) to pass to weave_poll().
+ *
+ * @param _name Queue variable name
+ * @param _depth Maximum number of events
+ */
+#define WEAVE_POLL_MSGQ_DEFINE(_name, _depth)                                                      \
+	WEAVE_MSGQ_DEFINE(_name, _depth);                                                          \
+	STRUCT_SECTION_ITERABLE(weave_poll_queue, _name##_poll) = {                                \
+		.queue = &_name,                                                                   \
+		.fd = -1,                                                                          \
+	}
+
+/* ============================ Poll Functions ============================ */
+
+/**
+ * @brief Wait on socket fds and weave queues, then process ready queues
+ *
+ * Blocks in zsock_poll() until one of fds or queues is ready. Ready
+ * queues are drained with weave_process_messages() before returning;
+ * revents of fds are filled in as by zsock_poll().
+ *
+ * The total of nfds and nqueues is limited by CONFIG_WEAVE_POLL_MAX_FDS.
+ *
+ * @param fds Socket poll descriptors (may be NULL if nfds is 0)
+ * @param nfds Number of socket poll descriptors
+ * @param queues Pollable queues (may be NULL if nqueues is 0)
+ * @param nqueues Number of pollable queues
+ * @param timeout_ms Poll timeout in milliseconds (-1 = forever)
+ *
+ * @return Number of fds with non-zero revents (0 if only queues were
+ *         ready or on timeout), or negative errno
+ */
+int weave_poll(struct zsock_pollfd *fds, int nfds, struct weave_poll_queue *const *queues,
+	       size_t nqueues, int timeout_ms);
+
+/**
+ * @brief Find the pollable queue of a queue
+ *
+ * Called by Weave core once per sink, when it is connected or first sent
+ * to. Do not call directly.
+ *
+ * @param queue Message queue
+ *
+ * @return Pollable queue, or NULL if queue is not pollable
+ */
+struct weave_poll_queue *weave_poll_queue_find(struct k_msgq *queue);
+
+/**
+ * @brief Signal a pollable queue after an enqueue
+ *
+ * Called by Weave core for every event put into a pollable queue. Do not
+ * call directly.
+ *
+ * @param pq Pollable queue that received an event
+ */
+void weave_poll_notify(struct weave_poll_queue *pq);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_INCLUDE_WEAVE_POLL_H_ */
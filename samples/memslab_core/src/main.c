@@ -10,6 +10,9 @@
  *
  * Key pattern: Per-source ops capture the slab pointer via macro,
  * enabling clean free without embedding metadata in the block.
+ *
+ * For multi-sink fan-out of custom types, see WEAVE_OBJ_POOL_DEFINE
+ * (<weave/obj_pool.h>), which adds a reference count per block.
  */
 
 #include <weave/core.h>
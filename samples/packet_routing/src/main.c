@@ -6,8 +6,9 @@
  *
  * Packet flow:
  *   sensor1_source ─┐
- *                   ├─→ protocol_outbound_sink → protocol_outbound_source ─→ tcp_sink
+ *                   ├─→ sensor_merge ─→ protocol_outbound_sink
  *   sensor2_source ─┘
+ *   protocol_outbound_source ─→ tcp_sink
  *
  * Command flow:
  *   tcp_rx_source → cmd_sink (start/stop sampling)
@@ -20,6 +21,7 @@
 #include <zephyr/net/net_context.h>
 #include <zephyr/net/net_mgmt.h>
 #include <weave/packet.h>
+#include <weave/packet_merge.h>
 
 #include "tcp_server.h"
 #include "protocol.h"
@@ -28,11 +30,16 @@
 
 LOG_MODULE_REGISTER(main, LOG_LEVEL_INF);
 
+/* Buffers the protocol and TCP RX pools borrow during bursts */
+WEAVE_PACKET_SHARED_RESERVE_DEFINE(burst_reserve, 4, 256);
+
 /* Wire up the connections at compile time */
 
-/* Sensors to protocol processor */
-WEAVE_CONNECT(&sensor1_source, &protocol_outbound_sink);
-WEAVE_CONNECT(&sensor2_source, &protocol_outbound_sink);
+/* Sensors to protocol processor, in sample order (wait up to 10 ms for the other sensor) */
+WEAVE_PACKET_MERGE_DEFINE(sensor_merge, 2, 4, 10000, WV_IMMEDIATE);
+WEAVE_CONNECT(&sensor1_source, &sensor_merge_input0);
+WEAVE_CONNECT(&sensor2_source, &sensor_merge_input1);
+WEAVE_CONNECT(&sensor_merge.source, &protocol_outbound_sink);
 
 /* Protocol processor to TCP server */
 WEAVE_CONNECT(&protocol_outbound_source, &tcp_sink);
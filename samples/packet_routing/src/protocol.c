@@ -2,30 +2,40 @@
  * Packet Routing Sample - Protocol Module Implementation
  *
  * Self-contained packet processor with own buffer pool and thread.
- * Uses weave packet metadata (packet_id, flags, counter, timestamp).
+ * Uses weave packet metadata (packet_id, flags, counter, timestamp),
+ * carried in a compact wire header delta-encoded per connection.
  */
 
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/net/buf.h>
+#include <zephyr/sys/atomic.h>
 #include <weave/packet.h>
+#include <weave/packet_cursor.h>
+#include <weave/packet_wire.h>
 
 #include "protocol.h"
 #include "sensors.h" /* For SOURCE_ID_SENSOR1/2 */
 
 LOG_MODULE_REGISTER(protocol, LOG_LEVEL_INF);
 
-/* Protocol packet header - private to protocol module */
-struct packet_header {
-	uint8_t packet_id;
-	uint8_t reserved;        /* Reserved for future use */
-	uint16_t counter;        /* From metadata */
-	uint16_t content_length; /* Length of payload (excluding header) */
-	uint64_t timestamp_ns;   /* Timestamp in nanoseconds */
-} __packed;
+/* Fields of the outbound wire header */
+#define PROTOCOL_WIRE_FIELDS                                                                       \
+	(WEAVE_PACKET_WIRE_F_ID | WEAVE_PACKET_WIRE_F_COUNTER | WEAVE_PACKET_WIRE_F_TIMESTAMP)
+
+/* Wire header delta state - only used from the protocol thread */
+static struct weave_packet_wire_ctx tx_wire;
+static struct weave_packet_wire_ctx rx_wire;
 
-/* Buffer pool for protocol headers */
-WEAVE_PACKET_POOL_DEFINE(protocol_pool, 4, sizeof(struct packet_header), NULL);
+/* Set by protocol_wire_resync(), applied by the protocol thread */
+#define WIRE_RESYNC_TX 0
+#define WIRE_RESYNC_RX 1
+static atomic_t wire_resync;
+
+/* Buffer pool for protocol headers - headers stay allocated while the TCP
+ * ring holds their packets, so bursts borrow from the shared reserve */
+WEAVE_PACKET_SHARED_RESERVE_DECLARE(burst_reserve);
+WEAVE_PACKET_ELASTIC_POOL_DEFINE(protocol_pool, 4, WEAVE_PACKET_WIRE_HDR_MAX, burst_reserve, 4);
 
 /* Event queue for protocol sink */
 WEAVE_MSGQ_DEFINE(protocol_queue, 10);
@@ -46,10 +56,15 @@ WEAVE_PACKET_SINK_DEFINE(protocol_inbound_sink, inbound_handler, &protocol_queue
 WEAVE_PACKET_SOURCE_DEFINE(protocol_outbound_source); /* For sending to TCP server */
 WEAVE_PACKET_SOURCE_DEFINE(protocol_inbound_source);  /* For sending processed inbound data */
 
+void protocol_wire_resync(void)
+{
+	atomic_or(&wire_resync, BIT(WIRE_RESYNC_TX) | BIT(WIRE_RESYNC_RX));
+}
+
 static inline void outbound_handler(struct net_buf *buf_ref, void *user_data)
 {
 	struct net_buf *header_buf;
-	struct packet_header *header;
+	struct weave_packet_wire_hdr header;
 	uint8_t packet_id;
 	uint16_t counter;
 	uint64_t cycles;
@@ -59,7 +74,9 @@ static inline void outbound_handler(struct net_buf *buf_ref, void *user_data)
 	/* Allocate buffer for header */
 	header_buf = weave_packet_alloc(&protocol_pool, K_NO_WAIT);
 	if (!header_buf) {
-		LOG_WRN("No buffer for header");
+		LOG_WRN("No buffer for header (borrowed %d times, denied %d)",
+			(int)atomic_get(&protocol_pool.borrow->borrows),
+			(int)atomic_get(&protocol_pool.borrow->denied));
 		return;
 	}
 
@@ -86,16 +103,28 @@ static inline void outbound_handler(struct net_buf *buf_ref, void *user_data)
 	cycles = k_ticks_to_cyc_floor64(ticks);
 #endif
 
-	/* Calculate the original payload length before chaining */
-	uint16_t payload_len = net_buf_frags_len(buf_ref);
+	/* A new connection starts from a sync header */
+	if (atomic_test_and_clear_bit(&wire_resync, WIRE_RESYNC_TX)) {
+		weave_packet_wire_reset(&tx_wire);
+	}
 
-	/* Fill in protocol header with metadata */
-	header = (struct packet_header *)net_buf_add(header_buf, sizeof(*header));
-	header->packet_id = packet_id;
-	header->reserved = 0;
-	header->counter = counter;
-	header->content_length = payload_len;
-	header->timestamp_ns = k_cyc_to_ns_floor64(cycles);
+	/* Encode protocol header with metadata; the payload length is taken before chaining */
+	header = (struct weave_packet_wire_hdr){
+		.flags = PROTOCOL_WIRE_FIELDS,
+		.packet_id = packet_id,
+		.len = net_buf_frags_len(buf_ref),
+		.counter = counter,
+		.timestamp_ns = k_cyc_to_ns_floor64(cycles),
+	};
+
+	int header_len = weave_packet_wire_encode(&tx_wire, &header, net_buf_tail(header_buf),
+						  net_buf_tailroom(header_buf));
+	if (header_len < 0) {
+		LOG_ERR("Failed to encode header: %d", header_len);
+		net_buf_unref(header_buf);
+		return;
+	}
+	net_buf_add(header_buf, header_len);
 
 	/* Chain original data after header - frag_add takes ownership of a buffer */
 	/* Take a new reference since the framework will unref the original */
@@ -121,10 +150,9 @@ static inline void outbound_handler(struct net_buf *buf_ref, void *user_data)
 
 	/* Log the processing with detailed packet info */
 	size_t total_len = net_buf_frags_len(header_buf);
-	LOG_INF("Processed: Sensor %d, counter=%u, timestamp=%llu ns, %zu bytes (header %zu + "
+	LOG_INF("Processed: Sensor %d, counter=%u, timestamp=%llu ns, %zu bytes (header %d + "
 		"payload %u)",
-		packet_id, counter, header->timestamp_ns, total_len, sizeof(*header),
-		header->content_length);
+		packet_id, counter, header.timestamp_ns, total_len, header_len, header.len);
 
 	/* Forward the packet with header to all connected sinks */
 	int ret = weave_packet_send(&protocol_outbound_source, header_buf, K_NO_WAIT);
@@ -136,38 +164,72 @@ static inline void outbound_handler(struct net_buf *buf_ref, void *user_data)
 /* Inbound handler - processes packets received from TCP server */
 static inline void inbound_handler(struct net_buf *buf_ref, void *user_data)
 {
-	struct packet_header *header;
+	struct weave_packet_wire_hdr header;
+	struct weave_packet_cursor cursor;
+	uint8_t scratch[WEAVE_PACKET_WIRE_HDR_MAX];
 
 	ARG_UNUSED(user_data);
 
-	/* Check if buffer has header */
-	if (buf_ref->len < sizeof(struct packet_header)) {
-		LOG_WRN("Inbound packet too small for header: %d bytes", buf_ref->len);
+	if (atomic_test_and_clear_bit(&wire_resync, WIRE_RESYNC_RX)) {
+		weave_packet_wire_reset(&rx_wire);
+	}
+
+	/* Decode header in place, or from a copy if it straddles fragments */
+	weave_packet_cursor_init(&cursor, buf_ref);
+
+	size_t avail = MIN(weave_packet_cursor_remaining(&cursor), sizeof(scratch));
+	const uint8_t *data = weave_packet_cursor_view(&cursor, avail);
+
+	if (!data) {
+		weave_packet_cursor_peek(&cursor, scratch, avail);
+		data = scratch;
+	}
+
+	int header_len = weave_packet_wire_decode(&rx_wire, data, avail, &header);
+
+	if (header_len < 0) {
+		LOG_WRN("Invalid inbound header (%d), %zu bytes", header_len, avail);
 		return;
 	}
 
-	/* Point to header in the buffer */
-	header = (struct packet_header *)buf_ref->data;
+	weave_packet_cursor_skip(&cursor, header_len);
+	if (weave_packet_cursor_remaining(&cursor) < header.len) {
+		LOG_WRN("Inbound payload truncated: %zu of %u bytes",
+			weave_packet_cursor_remaining(&cursor), header.len);
+		return;
+	}
 
 	/* Restore metadata from protocol header for routing */
-	weave_packet_set_id(buf_ref, header->packet_id);
-	weave_packet_set_counter(buf_ref, header->counter);
+	if (header.flags & WEAVE_PACKET_WIRE_F_ID) {
+		weave_packet_set_id(buf_ref, header.packet_id);
+	}
+
+	if (header.flags & WEAVE_PACKET_WIRE_F_COUNTER) {
+		weave_packet_set_counter(buf_ref, header.counter);
+	}
 
+	if (header.flags & WEAVE_PACKET_WIRE_F_TIMESTAMP) {
 #ifdef CONFIG_WEAVE_PACKET_TIMESTAMP_HIRES
-	/* Convert nanoseconds back to cycles for timestamp restoration */
-	uint64_t cycles = k_ns_to_cyc_floor64(header->timestamp_ns);
-	weave_packet_set_timestamp_cycles(buf_ref, cycles);
+		/* Convert nanoseconds back to cycles for timestamp restoration */
+		uint64_t cycles = k_ns_to_cyc_floor64(header.timestamp_ns);
+		weave_packet_set_timestamp_cycles(buf_ref, cycles);
 #else
-	/* Convert nanoseconds back to ticks */
-	uint32_t ticks = (uint32_t)k_ns_to_ticks_floor64(header->timestamp_ns);
-	weave_packet_set_timestamp_ticks(buf_ref, ticks);
+		/* Convert nanoseconds back to ticks */
+		uint32_t ticks = (uint32_t)k_ns_to_ticks_floor64(header.timestamp_ns);
+		weave_packet_set_timestamp_ticks(buf_ref, ticks);
 #endif
+	}
 
-	LOG_INF("Inbound: packet_id=%d, counter=%u, payload=%u bytes", header->packet_id,
-		header->counter, buf_ref->len - (uint16_t)sizeof(struct packet_header));
+	LOG_INF("Inbound: packet_id=%d, counter=%u, payload=%u bytes", header.packet_id,
+		header.counter, header.len);
 
-	/* Skip past the header to get to the payload */
-	net_buf_pull(buf_ref, sizeof(struct packet_header));
+	/* Skip past the header to get to the payload, leaving emptied fragments */
+	for (struct net_buf *frag = buf_ref; frag != cursor.frag; frag = frag->frags) {
+		net_buf_pull(frag, frag->len);
+	}
+	if (cursor.frag) {
+		net_buf_pull(cursor.frag, cursor.offset);
+	}
 
 	/* Forward the payload (without header) for further processing */
 	weave_packet_send_ref(&protocol_inbound_source, buf_ref, K_NO_WAIT);
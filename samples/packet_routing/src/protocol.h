@@ -15,4 +15,12 @@ WEAVE_PACKET_SINK_DECLARE(protocol_inbound_sink);      /* Receives from TCP serv
 WEAVE_PACKET_SOURCE_DECLARE(protocol_outbound_source); /* Sends to TCP */
 WEAVE_PACKET_SOURCE_DECLARE(protocol_inbound_source);  /* Sends processed inbound data */
 
+/**
+ * @brief Start the wire header deltas over for a new connection
+ *
+ * Safe to call from any thread; the next headers sent and received are
+ * sync headers.
+ */
+void protocol_wire_resync(void);
+
 #endif /* PROTOCOL_H */
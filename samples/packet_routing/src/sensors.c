@@ -13,8 +13,8 @@
 
 LOG_MODULE_REGISTER(sensors, LOG_LEVEL_INF);
 
-/* Buffer pool for sensor packets */
-WEAVE_PACKET_POOL_DEFINE(sensor_pool, 8, 512, NULL);
+/* Buffer pool for sensor packets - buffers reference the sensor data below */
+WEAVE_PACKET_REF_POOL_DEFINE(sensor_pool, 8);
 
 /* Define packet sources */
 WEAVE_PACKET_SOURCE_DEFINE(sensor1_source);
@@ -40,9 +40,30 @@ static void init_sensor_data(void)
 	}
 }
 
-static void sensor_thread_fn(void *p1, void *p2, void *p3)
+/* Send a sensor's payload in place - the pool's buffers reference it, nothing is copied */
+static int sensor_send(struct weave_source *source, uint8_t packet_id, const uint8_t *data,
+		       size_t len)
 {
 	struct net_buf *buf;
+
+	/* Only allocate if someone listens */
+	if (!weave_packet_would_deliver(source, packet_id)) {
+		return 0;
+	}
+
+	/* The sensor data is static, so nothing needs releasing */
+	buf = weave_packet_alloc_ref_data(&sensor_pool, data, len, NULL, NULL, K_NO_WAIT);
+	if (!buf) {
+		return -ENOMEM;
+	}
+
+	weave_packet_set_id(buf, packet_id);
+
+	return weave_packet_send(source, buf, K_NO_WAIT);
+}
+
+static void sensor_thread_fn(void *p1, void *p2, void *p3)
+{
 	int ret;
 
 	ARG_UNUSED(p1);
@@ -64,21 +85,17 @@ static void sensor_thread_fn(void *p1, void *p2, void *p3)
 		/* Check if sampling is enabled (non-blocking) */
 		if (k_sem_count_get(&sampling_sem) > 0) {
 			/* Sensor 1 packet - 256 bytes */
-			buf = weave_packet_alloc_with_id(&sensor_pool, SOURCE_ID_SENSOR1,
-							 K_NO_WAIT);
-			if (buf) {
-				net_buf_add_mem(buf, sensor1_data, sizeof(sensor1_data));
-				ret = weave_packet_send(&sensor1_source, buf, K_NO_WAIT);
+			ret = sensor_send(&sensor1_source, SOURCE_ID_SENSOR1, sensor1_data,
+					  sizeof(sensor1_data));
+			if (ret > 0) {
 				LOG_INF("Sensor 1: sent %d bytes to %d sinks",
 					(int)sizeof(sensor1_data), ret);
 			}
 
 			/* Sensor 2 packet - 384 bytes */
-			buf = weave_packet_alloc_with_id(&sensor_pool, SOURCE_ID_SENSOR2,
-							 K_NO_WAIT);
-			if (buf) {
-				net_buf_add_mem(buf, sensor2_data, sizeof(sensor2_data));
-				ret = weave_packet_send(&sensor2_source, buf, K_NO_WAIT);
+			ret = sensor_send(&sensor2_source, SOURCE_ID_SENSOR2, sensor2_data,
+					  sizeof(sensor2_data));
+			if (ret > 0) {
 				LOG_INF("Sensor 2: sent %d bytes to %d sinks",
 					(int)sizeof(sensor2_data), ret);
 			}
@@ -9,22 +9,40 @@
 #include <zephyr/net/buf.h>
 #include <zephyr/net/socket.h>
 #include <weave/packet.h>
+#include <weave/packet_aio.h>
+#include <weave/poll.h>
 
 #include "tcp_server.h"
+#include "protocol.h"
 
 LOG_MODULE_REGISTER(tcp_server, LOG_LEVEL_INF);
 
-/* Event queue for TCP sink */
-WEAVE_MSGQ_DEFINE(tcp_queue, 10);
+/* Event queue for TCP sink, served by the socket thread via weave_poll() */
+WEAVE_POLL_MSGQ_DEFINE(tcp_queue, 10);
 
-/* Buffer pool for TCP receive */
-WEAVE_PACKET_POOL_DEFINE(tcp_rx_pool, 3, 256, NULL);
+static struct weave_poll_queue *const tcp_poll_queues[] = {&tcp_queue_poll};
 
-/* Handler for TCP sink - receives packets to send to TCP client */
-static inline void tcp_sink_handler(struct net_buf *buf_ref, void *user_data);
+/* Buffer pool for TCP receive, borrowing from the shared reserve during bursts */
+WEAVE_PACKET_SHARED_RESERVE_DECLARE(burst_reserve);
+WEAVE_PACKET_ELASTIC_POOL_DEFINE(tcp_rx_pool, 3, 256, burst_reserve, 2);
 
-/* Define TCP sink with queued handler */
-WEAVE_PACKET_SINK_DEFINE(tcp_sink, tcp_sink_handler, &tcp_queue, WV_NO_FILTER, NULL);
+/* Packets handed to the socket and written together with one sendmsg() */
+#define TCP_TX_BATCH 4
+
+/* Packets waiting for the socket while a batch is being written */
+#define TCP_TX_DEPTH 8
+
+/* Maximum fragments gathered per sendmsg() call */
+#define TCP_IOV_MAX 16
+
+/* Backend of the TCP AIO channel - adds a packet to the next write */
+static int tcp_tx_submit(struct weave_packet_aio *aio, struct net_buf *buf);
+
+/* TCP AIO channel - the socket takes a batch of packets at a time */
+WEAVE_PACKET_AIO_DEFINE(tcp_tx, tcp_tx_submit, NULL, TCP_TX_BATCH, TCP_TX_DEPTH);
+
+/* Define TCP sink - packets are released when the socket has taken them */
+WEAVE_PACKET_AIO_SINK_DEFINE(tcp_sink, tcp_tx, &tcp_queue, WV_NO_FILTER);
 
 /* Define TCP source - forwards incoming packets from TCP client */
 WEAVE_PACKET_SOURCE_DEFINE(tcp_rx_source);
@@ -34,54 +52,181 @@ static int server_sock = -1;
 static int client_sock = -1;
 static bool client_connected = false;
 
+/* Packets handed to the socket, oldest first; the oldest may be partly written */
+static struct net_buf *tx_bufs[TCP_TX_BATCH];
+static size_t tx_head;
+static size_t tx_count;
+
+/* Fragment of the oldest packet being written, and offset into it */
+static struct net_buf *tx_frag;
+static size_t tx_offset;
+
+/* The socket had no room - retry once it polls writable */
+static bool tx_blocked;
+
+/* AIO drops already answered with a wire header resync */
+static uint32_t tx_dropped_seen;
+
 /* Statistics */
 static uint32_t packets_sent;
 static uint32_t bytes_sent;
 static uint32_t packets_received;
 
-/* TCP sink handler - sends packets to connected client */
-static inline void tcp_sink_handler(struct net_buf *buf_ref, void *user_data)
+/* Finish the oldest packet, which lets the channel hand over the next waiting one */
+static void tcp_tx_done(int result)
 {
-	ARG_UNUSED(user_data);
+	struct net_buf *buf = tx_bufs[tx_head];
 
-	LOG_INF("TCP sink handler called, client_connected=%d, client_sock=%d", client_connected,
-		client_sock);
+	tx_head = (tx_head + 1) % TCP_TX_BATCH;
+	tx_count--;
+	tx_frag = tx_count > 0 ? tx_bufs[tx_head] : NULL;
+	tx_offset = 0;
 
-	if (!client_connected || client_sock < 0) {
-		LOG_WRN("No client connected, dropping packet");
-		return;
+	if (result == 0) {
+		packets_sent++;
+		bytes_sent += net_buf_frags_len(buf);
+		LOG_DBG("TCP: sent packet to client (total: %u packets)", packets_sent);
 	}
 
-	/* Send the complete packet (with protocol header) to TCP client */
-	struct net_buf *frag = buf_ref;
-	ssize_t sent_total = 0;
+	weave_packet_aio_complete(&tcp_tx, buf, result);
+}
+
+/* Drop the client connection, failing every packet handed to the socket */
+static void tcp_client_drop(void)
+{
+	client_connected = false;
+	close(client_sock);
+	client_sock = -1;
 
-	while (frag) {
-		ssize_t sent = send(client_sock, frag->data, frag->len, 0);
+	/* Waiting packets are failed by tcp_tx_submit() as their turn comes */
+	while (tx_count > 0) {
+		tcp_tx_done(-ECONNRESET);
+	}
+	tx_blocked = false;
+}
+
+/* Write as much of every packet handed over as the socket takes without blocking */
+static void tcp_tx_continue(void)
+{
+	/* Gather the remaining fragments of all packets (with protocol headers) into one iovec */
+	struct iovec iov[TCP_IOV_MAX];
+	size_t iov_len = 0;
+	size_t offset = tx_offset;
+	ssize_t sent = 0;
+
+	for (size_t i = 0; i < tx_count && iov_len < ARRAY_SIZE(iov); i++) {
+		struct net_buf *frag = i == 0 ? tx_frag : tx_bufs[(tx_head + i) % TCP_TX_BATCH];
+
+		for (; frag && iov_len < ARRAY_SIZE(iov); frag = frag->frags) {
+			if (frag->len > offset) {
+				iov[iov_len].iov_base = frag->data + offset;
+				iov[iov_len].iov_len = frag->len - offset;
+				iov_len++;
+			}
+			offset = 0;
+		}
+	}
+
+	if (iov_len > 0) {
+		struct msghdr msg = {
+			.msg_iov = iov,
+			.msg_iovlen = iov_len,
+		};
+
+		sent = sendmsg(client_sock, &msg, MSG_DONTWAIT);
 		if (sent < 0) {
 			if (errno == EAGAIN || errno == EWOULDBLOCK) {
-				LOG_WRN("TCP send would block");
-				break;
+				/* Resumed when the socket polls writable */
+				tx_blocked = true;
+			} else {
+				LOG_ERR("TCP send failed: %d", errno);
+				tcp_client_drop();
 			}
-			LOG_ERR("TCP send failed: %d", errno);
-			client_connected = false;
-			close(client_sock);
-			client_sock = -1;
 			return;
 		}
-		sent_total += sent;
-		frag = frag->frags;
 	}
 
-	if (sent_total > 0) {
-		packets_sent++;
-		bytes_sent += sent_total;
-		LOG_INF("TCP: sent %zd bytes to client (total: %u packets)", sent_total,
-			packets_sent);
+	/* Advance past what the socket took, completing every packet it took whole */
+	while (tx_count > 0) {
+		while (tx_frag && (size_t)sent >= tx_frag->len - tx_offset) {
+			sent -= tx_frag->len - tx_offset;
+			tx_frag = tx_frag->frags;
+			tx_offset = 0;
+		}
+
+		if (tx_frag) {
+			tx_offset += sent;
+			return;
+		}
+
+		tcp_tx_done(0);
+	}
+}
+
+static int tcp_tx_submit(struct weave_packet_aio *aio, struct net_buf *buf)
+{
+	ARG_UNUSED(aio);
+
+	if (!client_connected || client_sock < 0) {
+		LOG_WRN("No client connected, dropping packet");
+		return -ENOTCONN;
 	}
+
+	/* The channel hands over at most TCP_TX_BATCH packets at once */
+	tx_bufs[(tx_head + tx_count) % TCP_TX_BATCH] = buf;
+	if (tx_count++ == 0) {
+		tx_frag = buf;
+		tx_offset = 0;
+	}
+
+	/* Written by tcp_tx_continue() with the rest of the batch once the poll round is over */
+	return 0;
+}
+
+/* Wait until sock is readable, writing queued TX packets meanwhile */
+static int tcp_wait_readable(int sock)
+{
+	struct zsock_pollfd fds[2];
+	int ret;
+
+	do {
+		int nfds = 0;
+
+		fds[nfds++] = (struct zsock_pollfd){.fd = sock, .events = ZSOCK_POLLIN};
+
+		/* Resume a partial write once the socket has room */
+		if (tx_count > 0) {
+			fds[nfds++] = (struct zsock_pollfd){.fd = client_sock,
+							    .events = ZSOCK_POLLOUT};
+		}
+
+		ret = weave_poll(fds, nfds, tcp_poll_queues, ARRAY_SIZE(tcp_poll_queues), -1);
+
+		/* A dropped packet took a header delta with it - restart the deltas */
+		if (tcp_tx.dropped != tx_dropped_seen) {
+			tx_dropped_seen = tcp_tx.dropped;
+			protocol_wire_resync();
+		}
+
+		if (ret > 0 && nfds > 1 && fds[1].revents) {
+			tx_blocked = false;
+		}
+
+		/* One sendmsg() for every packet the sink handed over this round */
+		if (tx_count > 0 && !tx_blocked) {
+			tcp_tx_continue();
+		}
+
+		/* A failed write may have dropped the client */
+		if (sock != server_sock && !client_connected) {
+			return 0;
+		}
+	} while (ret >= 0 && !fds[0].revents);
+
+	return ret < 0 ? ret : 0;
 }
 
-/* TCP server thread */
+/* TCP server thread - socket RX and weave TX on one thread */
 static void tcp_server_thread_fn(void *p1, void *p2, void *p3)
 {
 	ARG_UNUSED(p1);
@@ -124,32 +269,30 @@ static void tcp_server_thread_fn(void *p1, void *p2, void *p3)
 		return;
 	}
 
-	/* Set accept timeout to allow cooperative scheduling */
-	struct timeval accept_timeout;
-	accept_timeout.tv_sec = 0;
-	accept_timeout.tv_usec = 100000; /* 100ms */
-	setsockopt(server_sock, SOL_SOCKET, SO_RCVTIMEO, &accept_timeout, sizeof(accept_timeout));
-
 	LOG_INF("TCP server listening on 127.0.0.1:%d", TCP_SERVER_PORT);
 
 	while (1) {
 		struct sockaddr_in client_addr;
 		socklen_t client_addr_len = sizeof(client_addr);
 
-		/* Accept client connection (with timeout for native_sim compatibility) */
+		/* Packets arriving without a client are dropped by the TCP backend */
+		ret = tcp_wait_readable(server_sock);
+		if (ret < 0) {
+			LOG_ERR("Poll failed: %d", ret);
+			k_sleep(K_SECONDS(1));
+			continue;
+		}
+
 		client_sock =
 			accept(server_sock, (struct sockaddr *)&client_addr, &client_addr_len);
 		if (client_sock < 0) {
-			if (errno == EAGAIN || errno == EWOULDBLOCK) {
-				/* Timeout - yield to other threads and retry */
-				k_sleep(K_MSEC(10));
-				continue;
-			}
 			LOG_ERR("Failed to accept connection: %d", errno);
 			k_sleep(K_SECONDS(1));
 			continue;
 		}
 
+		/* The client decodes the wire header from its first sync header */
+		protocol_wire_resync();
 		client_connected = true;
 		char addr_str[INET_ADDRSTRLEN];
 		inet_ntop(AF_INET, &client_addr.sin_addr, addr_str, sizeof(addr_str));
@@ -157,10 +300,24 @@ static void tcp_server_thread_fn(void *p1, void *p2, void *p3)
 
 		/* Handle client communication */
 		while (client_connected) {
+			/* Serves TX packets until the client sends something */
+			ret = tcp_wait_readable(client_sock);
+			if (ret < 0) {
+				LOG_ERR("Poll failed: %d", ret);
+				break;
+			}
+
+			/* A failed send may have dropped the client while polling */
+			if (!client_connected) {
+				break;
+			}
+
 			/* Allocate buffer from pool */
 			struct net_buf *rx_buf = weave_packet_alloc(&tcp_rx_pool, K_NO_WAIT);
 			if (!rx_buf) {
-				LOG_WRN("No buffer available for TCP RX");
+				LOG_WRN("No buffer for TCP RX (borrowed %d times, denied %d)",
+					(int)atomic_get(&tcp_rx_pool.borrow->borrows),
+					(int)atomic_get(&tcp_rx_pool.borrow->denied));
 				k_sleep(K_MSEC(10));
 				continue;
 			}
@@ -171,7 +328,6 @@ static void tcp_server_thread_fn(void *p1, void *p2, void *p3)
 			if (received < 0) {
 				if (errno == EAGAIN || errno == EWOULDBLOCK) {
 					net_buf_unref(rx_buf);
-					k_sleep(K_MSEC(10));
 					continue;
 				}
 				LOG_ERR("TCP recv failed: %d", errno);
@@ -198,37 +354,12 @@ static void tcp_server_thread_fn(void *p1, void *p2, void *p3)
 		}
 
 		/* Client disconnected */
-		client_connected = false;
-		close(client_sock);
-		client_sock = -1;
-		LOG_INF("Client session ended");
-	}
-}
-
-/* Event processing thread */
-static void tcp_event_thread_fn(void *p1, void *p2, void *p3)
-{
-	ARG_UNUSED(p1);
-	ARG_UNUSED(p2);
-	ARG_UNUSED(p3);
-
-	LOG_INF("TCP event processor started");
-
-	while (1) {
-		/* Wait for events on the queue using poll */
-		struct k_poll_event events[1] = {
-			K_POLL_EVENT_STATIC_INITIALIZER(K_POLL_TYPE_MSGQ_DATA_AVAILABLE,
-							K_POLL_MODE_NOTIFY_ONLY, &tcp_queue, 0),
-		};
-
-		int ret = k_poll(events, 1, K_FOREVER);
-		if (ret == 0) {
-			/* Process all available messages */
-			weave_process_messages(&tcp_queue, K_NO_WAIT);
+		if (client_sock >= 0) {
+			tcp_client_drop();
 		}
+		LOG_INF("Client session ended");
 	}
 }
 
-/* Auto-start threads */
+/* Auto-start thread */
 K_THREAD_DEFINE(tcp_server_thread, 2048, tcp_server_thread_fn, NULL, NULL, NULL, 7, 0, 0);
-K_THREAD_DEFINE(tcp_event_thread, 1024, tcp_event_thread_fn, NULL, NULL, NULL, 7, 0, 0);
@@ -8,7 +8,6 @@ Can be used as:
 """
 
 import socket
-import struct
 import sys
 import threading
 import time
@@ -20,6 +19,13 @@ from typing import Optional, Callable
 CMD_START_SAMPLING = 0x01
 CMD_STOP_SAMPLING = 0x02
 
+# Wire header flags (see weave/packet_wire.h)
+WIRE_F_ID = 0x01
+WIRE_F_CLIENT_ID = 0x02
+WIRE_F_COUNTER = 0x04
+WIRE_F_TIMESTAMP = 0x08
+WIRE_F_SYNC = 0x10
+
 
 @dataclass
 class SensorPacket:
@@ -50,6 +56,10 @@ class SampleClient:
         self.connected = False
         self.packet_count = 0
         self.bytes_received = 0
+        # Wire header delta state, restarted by each connection
+        self.wire_synced = False
+        self.wire_counter = 0
+        self.wire_timestamp_ns = 0
 
     def connect(self) -> bool:
         """Connect to TCP server"""
@@ -58,6 +68,7 @@ class SampleClient:
             self.sock.settimeout(self.timeout)
             self.sock.connect((self.host, self.port))
             self.connected = True
+            self.wire_synced = False
             return True
         except Exception as e:
             print(f"Connection failed: {e}")
@@ -99,29 +110,33 @@ class SampleClient:
             return None
 
         try:
-            # Read packet header (14 bytes)
-            header_data = self._recv_exact(14)
-            if not header_data:
-                return None
+            while True:
+                header = self._recv_wire_header()
+                if header is None:
+                    return None
 
-            # Unpack header: packet_id, reserved, counter, content_length, timestamp_ns
-            packet_id, reserved, counter, content_length, timestamp_ns = struct.unpack("<BBHHQ", header_data)
+                flags, packet_id, counter, content_length, timestamp_ns, header_len = header
 
-            # Read payload
-            payload = self._recv_exact(content_length)
-            if not payload:
-                return None
+                # Read payload
+                payload = self._recv_exact(content_length)
+                if not payload:
+                    return None
+
+                self.bytes_received += header_len + content_length
 
-            self.packet_count += 1
-            self.bytes_received += 14 + content_length
+                # Sent before this connection's sync header: deltas have no base
+                if not self.wire_synced:
+                    continue
 
-            return SensorPacket(
-                packet_id=packet_id,
-                counter=counter,
-                timestamp_ns=timestamp_ns,
-                content_length=content_length,
-                payload=payload
-            )
+                self.packet_count += 1
+
+                return SensorPacket(
+                    packet_id=packet_id,
+                    counter=counter,
+                    timestamp_ns=timestamp_ns,
+                    content_length=content_length,
+                    payload=payload
+                )
 
         except socket.timeout:
             return None
@@ -167,6 +182,75 @@ class SampleClient:
             if not callback(packet):
                 break
 
+    def _recv_varint(self) -> Optional[tuple[int, int]]:
+        """Receive a varint, returning (value, bytes read)"""
+        value = 0
+        for i in range(10):
+            byte = self._recv_exact(1)
+            if not byte:
+                return None
+            value |= (byte[0] & 0x7F) << (7 * i)
+            if not byte[0] & 0x80:
+                return value, i + 1
+        raise ValueError("Varint too long")
+
+    @staticmethod
+    def _unzigzag(value: int) -> int:
+        return (value >> 1) ^ -(value & 1)
+
+    def _recv_wire_header(self) -> Optional[tuple[int, int, int, int, int, int]]:
+        """
+        Receive a compact wire header:
+          flags | length (varint) | [packet_id] | [client_id] | [counter] | [timestamp_ns]
+        Counter and timestamp are zigzag deltas, or absolute in a sync header.
+        Returns (flags, packet_id, counter, length, timestamp_ns, header length).
+        """
+        flags_data = self._recv_exact(1)
+        if not flags_data:
+            return None
+        flags = flags_data[0]
+        if flags & ~0x1F:
+            raise ValueError(f"Invalid wire header flags: {flags:#x}")
+
+        field = self._recv_varint()
+        if field is None:
+            return None
+        length, header_len = field[0], 1 + field[1]
+
+        packet_id = 0
+        for present in (WIRE_F_ID, WIRE_F_CLIENT_ID):
+            if flags & present:
+                data = self._recv_exact(1)
+                if not data:
+                    return None
+                if present == WIRE_F_ID:
+                    packet_id = data[0]
+                header_len += 1
+
+        sync = bool(flags & WIRE_F_SYNC)
+        if sync:
+            self.wire_synced = True
+            self.wire_counter = 0
+            self.wire_timestamp_ns = 0
+
+        if flags & WIRE_F_COUNTER:
+            field = self._recv_varint()
+            if field is None:
+                return None
+            delta = field[0] if sync else self._unzigzag(field[0])
+            self.wire_counter = (self.wire_counter + delta) & 0xFFFF
+            header_len += field[1]
+
+        if flags & WIRE_F_TIMESTAMP:
+            field = self._recv_varint()
+            if field is None:
+                return None
+            delta = field[0] if sync else self._unzigzag(field[0])
+            self.wire_timestamp_ns = (self.wire_timestamp_ns + delta) & 0xFFFFFFFFFFFFFFFF
+            header_len += field[1]
+
+        return flags, packet_id, self.wire_counter, length, self.wire_timestamp_ns, header_len
+
     def _recv_exact(self, n: int) -> Optional[bytes]:
         """Receive exactly n bytes from socket"""
         data = bytearray()
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Shared Memory Transport Sample - host wall clock
+ *
+ * native_sim only advances simulated time while the CPU idles, so time
+ * spent spinning on the link would not be measured. This file is built
+ * for the host and reads its monotonic clock instead.
+ */
+
+#include <stdint.h>
+#include <time.h>
+
+uint64_t sample_host_time_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return (uint64_t)ts.tv_sec * 1000000000U + ts.tv_nsec;
+}
@@ -0,0 +1,327 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Shared Memory Transport Sample - ping/pong between two native_sim processes
+ *
+ * The pong process (built with pong.conf) creates the shared memory link
+ * and echoes every packet back, and runs a TCP echo server on localhost.
+ * The ping process attaches to both and measures round trip latency and
+ * windowed throughput of the shared memory transport and of TCP:
+ *
+ *   west build -d build/pong -b native_sim -- -DEXTRA_CONF_FILE=pong.conf
+ *   west build -d build/ping -b native_sim
+ *   build/pong/zephyr/zephyr.exe & build/ping/zephyr/zephyr.exe
+ *
+ * With loopback.conf both sides run in one process, the echo side on its own
+ * threads. Both then share one simulated CPU, so the figures check that the
+ * comparison runs end to end rather than reproduce the two process results.
+ */
+
+#include <weave/packet_shm.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/net/socket.h>
+
+LOG_MODULE_REGISTER(shm_transport_sample, LOG_LEVEL_INF);
+
+#define SHM_NAME      "/weave_shm_transport_sample"
+#define SHM_RING_SIZE 4096
+#define SHM_SLICES    16
+#define TCP_PORT      CONFIG_SHM_TRANSPORT_TCP_PORT
+
+/* Benchmark parameters, fewer rounds when each echo waits for a tick */
+#define BENCH_LEN     64
+#define RTT_ROUNDS    (IS_ENABLED(CONFIG_SHM_TRANSPORT_LOOPBACK) ? 200 : 2000)
+#define BENCH_PACKETS (IS_ENABLED(CONFIG_SHM_TRANSPORT_LOOPBACK) ? 2000 : 20000)
+#define BENCH_WINDOW  16
+
+/* Built for the host, see host_clock.c */
+uint64_t sample_host_time_ns(void);
+
+#if defined(CONFIG_SHM_TRANSPORT_PONG) || defined(CONFIG_SHM_TRANSPORT_LOOPBACK)
+
+/* ========================== Echo Side ========================== */
+
+/* The echo side creates the link, the measuring side attaches */
+WEAVE_PACKET_SHM_DEFINE(echo_link, SHM_NAME, 0, SHM_RING_SIZE, SHM_SLICES);
+
+/* Every received slice goes straight back into the TX ring */
+WEAVE_CONNECT(&echo_link_source, &echo_link_sink);
+
+static void tcp_echo(int client)
+{
+	uint8_t data[256];
+	ssize_t len;
+
+	while ((len = recv(client, data, sizeof(data), 0)) > 0) {
+		for (ssize_t off = 0; off < len;) {
+			ssize_t ret = send(client, data + off, len - off, 0);
+
+			if (ret < 0) {
+				return;
+			}
+			off += ret;
+		}
+	}
+}
+
+static void tcp_echo_thread(void *p1, void *p2, void *p3)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(TCP_PORT),
+		.sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+	};
+	int one = 1;
+	int server = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+
+	if (server < 0) {
+		LOG_ERR("Failed to create socket: %d", errno);
+		return;
+	}
+
+	setsockopt(server, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+	if (bind(server, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(server, 1) < 0) {
+		LOG_ERR("Failed to listen on port %d: %d", TCP_PORT, errno);
+		close(server);
+		return;
+	}
+
+	while (true) {
+		int client = accept(server, NULL, NULL);
+
+		if (client < 0) {
+			continue;
+		}
+
+		setsockopt(client, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+		tcp_echo(client);
+		close(client);
+	}
+}
+
+K_THREAD_DEFINE(tcp_echo_tid, 2048, tcp_echo_thread, NULL, NULL, NULL, 7, 0, 0);
+
+static int echo_run(void)
+{
+	int ret = weave_packet_shm_init(&echo_link, K_NO_WAIT);
+
+	if (ret < 0) {
+		LOG_ERR("Failed to create shared memory link: %d", ret);
+		return ret;
+	}
+
+	LOG_INF("Echoing on %s and TCP port %d", SHM_NAME, TCP_PORT);
+
+	while (true) {
+		weave_packet_shm_receive(&echo_link, K_FOREVER);
+	}
+
+	return 0;
+}
+
+#endif /* CONFIG_SHM_TRANSPORT_PONG || CONFIG_SHM_TRANSPORT_LOOPBACK */
+
+#ifdef CONFIG_SHM_TRANSPORT_PONG
+
+int main(void)
+{
+	LOG_INF("SHM Transport Sample - echo side");
+
+	return echo_run();
+}
+
+#else /* !CONFIG_SHM_TRANSPORT_PONG */
+
+/* ========================== Measuring Side ========================== */
+
+#ifdef CONFIG_SHM_TRANSPORT_LOOPBACK
+static void shm_echo_thread(void *p1, void *p2, void *p3)
+{
+	echo_run();
+}
+
+K_THREAD_DEFINE(shm_echo_tid, 2048, shm_echo_thread, NULL, NULL, NULL, 7, 0, 0);
+#endif
+
+WEAVE_PACKET_SHM_DEFINE(shm_link, SHM_NAME, 1, SHM_RING_SIZE, SHM_SLICES);
+
+/* Packets are copied into the ring on send, so two buffers suffice */
+WEAVE_PACKET_POOL_DEFINE(bench_pool, 2, BENCH_LEN, NULL);
+
+WEAVE_PACKET_SOURCE_DEFINE(bench_source);
+WEAVE_CONNECT(&bench_source, &shm_link_sink);
+
+static uint32_t rx_packets;
+static uint32_t rx_bad;
+
+static void rx_handler(struct net_buf *buf, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	/* Echoes arrive in order, tagged with their sequence number */
+	if (buf->len != BENCH_LEN || buf->data[0] != (uint8_t)rx_packets) {
+		rx_bad++;
+	}
+	rx_packets++;
+}
+
+WEAVE_PACKET_SINK_DEFINE(rx_sink, rx_handler, WV_IMMEDIATE, WV_NO_FILTER, NULL);
+WEAVE_CONNECT(&shm_link_source, &rx_sink);
+
+/* Exchange packets with up to window in flight; returns elapsed ns */
+static int64_t shm_run(uint32_t packets, uint32_t window)
+{
+	uint64_t start = sample_host_time_ns();
+	uint32_t sent = 0;
+
+	rx_packets = 0;
+
+	while (rx_packets < packets) {
+		while (sent < packets && sent - rx_packets < window) {
+			struct net_buf *buf = weave_packet_alloc(&bench_pool, K_FOREVER);
+
+			memset(net_buf_add(buf, BENCH_LEN), (uint8_t)sent, BENCH_LEN);
+			weave_packet_send(&bench_source, buf, K_NO_WAIT);
+			sent++;
+		}
+
+		if (weave_packet_shm_receive(&shm_link, K_SECONDS(1)) < 0) {
+			return -ETIMEDOUT;
+		}
+	}
+
+	uint32_t dropped = atomic_get(&shm_link.tx_dropped);
+
+	if (dropped > 0 || rx_bad > 0) {
+		LOG_ERR("SHM: %u dropped, %u bad", dropped, rx_bad);
+		return -EIO;
+	}
+
+	return sample_host_time_ns() - start;
+}
+
+static int tcp_xfer(int sock, uint8_t *data, size_t len, bool tx)
+{
+	for (size_t off = 0; off < len;) {
+		ssize_t ret = tx ? send(sock, data + off, len - off, 0)
+				 : recv(sock, data + off, len - off, 0);
+
+		if (ret <= 0) {
+			return -EIO;
+		}
+		off += ret;
+	}
+
+	return 0;
+}
+
+/* Same exchange over the TCP connection */
+static int64_t tcp_run(int sock, uint32_t packets, uint32_t window)
+{
+	uint64_t start = sample_host_time_ns();
+	uint8_t data[BENCH_LEN];
+	uint32_t sent = 0;
+	uint32_t received = 0;
+
+	while (received < packets) {
+		while (sent < packets && sent - received < window) {
+			memset(data, (uint8_t)sent, sizeof(data));
+			if (tcp_xfer(sock, data, sizeof(data), true) < 0) {
+				return -EIO;
+			}
+			sent++;
+		}
+
+		if (tcp_xfer(sock, data, sizeof(data), false) < 0) {
+			return -EIO;
+		}
+		if (data[0] != (uint8_t)received++) {
+			return -EIO;
+		}
+	}
+
+	return sample_host_time_ns() - start;
+}
+
+static int tcp_connect(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(TCP_PORT),
+		.sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+	};
+	int one = 1;
+
+	for (int attempt = 0; attempt < 50; attempt++) {
+		int sock = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+
+		if (sock < 0) {
+			return -errno;
+		}
+
+		if (connect(sock, (struct sockaddr *)&addr, sizeof(addr)) == 0) {
+			setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+			return sock;
+		}
+
+		close(sock);
+		k_sleep(K_MSEC(100));
+	}
+
+	return -ECONNREFUSED;
+}
+
+static void report(const char *name, int64_t rtt_ns, int64_t run_ns)
+{
+	uint32_t rtt_avg = rtt_ns / RTT_ROUNDS;
+
+	LOG_INF("%s: RTT %u.%03u us, %u packets/s, %u MB/s", name, rtt_avg / 1000, rtt_avg % 1000,
+		(uint32_t)((uint64_t)BENCH_PACKETS * NSEC_PER_SEC / run_ns),
+		(uint32_t)((uint64_t)BENCH_PACKETS * BENCH_LEN * 1000 / run_ns));
+}
+
+int main(void)
+{
+	LOG_INF("SHM Transport Sample - %u byte packets, window %u", BENCH_LEN, BENCH_WINDOW);
+
+	int ret = weave_packet_shm_init(&shm_link, K_SECONDS(30));
+
+	if (ret < 0) {
+		LOG_ERR("Failed to attach to %s: %d (is pong running?)", SHM_NAME, ret);
+		return ret;
+	}
+
+	int64_t rtt = shm_run(RTT_ROUNDS, 1);
+	int64_t run = rtt < 0 ? rtt : shm_run(BENCH_PACKETS, BENCH_WINDOW);
+
+	if (run < 0) {
+		LOG_ERR("SHM benchmark failed: %d", (int)run);
+		return run;
+	}
+	report("SHM", rtt, run);
+
+	int sock = tcp_connect();
+
+	if (sock < 0) {
+		LOG_ERR("Failed to connect to TCP port %d: %d", TCP_PORT, sock);
+		return sock;
+	}
+
+	rtt = tcp_run(sock, RTT_ROUNDS, 1);
+	run = rtt < 0 ? rtt : tcp_run(sock, BENCH_PACKETS, BENCH_WINDOW);
+	close(sock);
+
+	if (run < 0) {
+		LOG_ERR("TCP benchmark failed: %d", (int)run);
+		return run;
+	}
+	report("TCP", rtt, run);
+
+	LOG_INF("Sample completed successfully");
+	return 0;
+}
+
+#endif /* CONFIG_SHM_TRANSPORT_PONG */
@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * UDP Transport Sample - datagram transport benchmarked against TCP
+ *
+ * Sends bursts of small packets over localhost, once through a pair of
+ * weave UDP transports and once through a TCP connection whose receiver
+ * splits the stream back into packets, as a stream transport must. For
+ * each packet size it reports packets per second and packets handled
+ * per receiver wake-up: at small sizes the per-call cost dominates, and
+ * a datagram transport needs no framing to recover packet boundaries.
+ */
+
+#include <weave/packet_udp.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/sys/byteorder.h>
+
+LOG_MODULE_REGISTER(udp_transport_sample, LOG_LEVEL_INF);
+
+#define UDP_RX_PORT 4250
+#define UDP_TX_PORT 4251
+#define TCP_PORT    4252
+
+/* Benchmark parameters */
+#define BENCH_PACKETS 5000
+#define BENCH_BURST   32
+#define BENCH_MAX_LEN 256
+#define WAIT_MS       100
+
+static const uint16_t bench_sizes[] = {16, 64, BENCH_MAX_LEN};
+
+/* Built for the host, see host_clock.c */
+uint64_t sample_host_time_ns(void);
+
+/* ========================== Pools and Transports ========================== */
+
+WEAVE_PACKET_POOL_DEFINE(tx_pool, 4, BENCH_MAX_LEN, NULL);
+WEAVE_PACKET_POOL_DEFINE(rx_pool, 8, BENCH_MAX_LEN, NULL);
+
+WEAVE_PACKET_UDP_DEFINE(udp_tx, WV_IMMEDIATE, &rx_pool, 1);
+WEAVE_PACKET_UDP_DEFINE(udp_rx, WV_IMMEDIATE, &rx_pool, 1);
+
+/* TCP sender sink: one send() per packet, as a stream transport does */
+static int tcp_client = -1;
+static uint32_t tcp_tx_errors;
+
+static void tcp_tx_handler(struct net_buf *buf, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	for (struct net_buf *frag = buf; frag; frag = frag->frags) {
+		for (size_t off = 0; off < frag->len;) {
+			ssize_t ret = send(tcp_client, frag->data + off, frag->len - off, 0);
+
+			if (ret < 0) {
+				tcp_tx_errors++;
+				return;
+			}
+			off += ret;
+		}
+	}
+}
+
+WEAVE_PACKET_SINK_DEFINE(tcp_tx_sink, tcp_tx_handler, WV_IMMEDIATE, WV_NO_FILTER, NULL);
+
+/* TCP receiver: packets recovered from the stream */
+WEAVE_PACKET_SOURCE_DEFINE(tcp_rx_source);
+
+/* ========================== Benchmark Wiring ========================== */
+
+WEAVE_PACKET_SOURCE_DEFINE(udp_bench_source);
+WEAVE_PACKET_SOURCE_DEFINE(tcp_bench_source);
+WEAVE_BATCH_CONNECT(&udp_bench_source, udp_tx_sink);
+WEAVE_CONNECT(&tcp_bench_source, &tcp_tx_sink);
+
+static uint16_t rx_len;
+static uint32_t rx_next;
+static uint32_t rx_packets;
+static uint32_t rx_bad;
+
+static void rx_handler(struct net_buf *buf, void *user_data)
+{
+	ARG_UNUSED(user_data);
+
+	/* Packets carry their sequence number; UDP may lose some, never reorder here */
+	uint32_t seq = sys_get_le32(buf->data);
+
+	if (net_buf_frags_len(buf) != rx_len || seq < rx_next) {
+		rx_bad++;
+	} else {
+		rx_next = seq + 1;
+	}
+	rx_packets++;
+}
+
+WEAVE_PACKET_SINK_DEFINE(rx_sink, rx_handler, WV_IMMEDIATE, WV_NO_FILTER, NULL);
+WEAVE_CONNECT(&udp_rx_source, &rx_sink);
+WEAVE_CONNECT(&tcp_rx_source, &rx_sink);
+
+struct bench_result {
+	uint64_t elapsed_ns;
+	uint32_t received;
+	uint32_t wakeups;
+};
+
+static void bench_send(struct weave_source *source, uint16_t len, uint32_t seq)
+{
+	struct net_buf *buf = weave_packet_alloc(&tx_pool, K_FOREVER);
+	uint8_t *data = net_buf_add(buf, len);
+
+	memset(data, 0xA5, len);
+	sys_put_le32(seq, data);
+	weave_packet_send(source, buf, K_NO_WAIT);
+}
+
+/* ========================== Receivers ========================== */
+
+/* One wake-up of the UDP receiver: up to a batch of datagrams */
+static int udp_drain(void)
+{
+	return weave_packet_udp_receive(&udp_rx);
+}
+
+/* One wake-up of the TCP receiver: read what is there, cut into packets */
+static struct net_buf *tcp_partial;
+static int tcp_conn = -1;
+
+static int tcp_drain(void)
+{
+	while (true) {
+		if (!tcp_partial) {
+			tcp_partial = weave_packet_alloc(&rx_pool, K_NO_WAIT);
+			if (!tcp_partial) {
+				return -ENOMEM;
+			}
+		}
+
+		ssize_t ret = recv(tcp_conn, tcp_partial->data + tcp_partial->len,
+				   rx_len - tcp_partial->len, MSG_DONTWAIT);
+
+		if (ret < 0) {
+			return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -errno;
+		}
+		if (ret == 0) {
+			return -ECONNRESET;
+		}
+
+		net_buf_add(tcp_partial, ret);
+		if (tcp_partial->len == rx_len) {
+			weave_packet_send(&tcp_rx_source, tcp_partial, K_NO_WAIT);
+			tcp_partial = NULL;
+		}
+	}
+}
+
+/* ========================== Benchmark ========================== */
+
+static int bench_run(struct weave_source *source, int rx_sock, int (*drain)(void), uint16_t len,
+		     struct bench_result *result)
+{
+	struct zsock_pollfd fd = {.fd = rx_sock, .events = ZSOCK_POLLIN};
+	uint64_t start = sample_host_time_ns();
+	uint32_t sent = 0;
+
+	rx_len = len;
+	rx_next = 0;
+	rx_packets = 0;
+	rx_bad = 0;
+	*result = (struct bench_result){0};
+
+	while (sent < BENCH_PACKETS) {
+		uint32_t burst_end = MIN(sent + BENCH_BURST, BENCH_PACKETS);
+
+		while (sent < burst_end) {
+			bench_send(source, len, sent++);
+		}
+
+		/* Datagrams lost on the way leave the burst short - move on */
+		while (rx_packets < sent && zsock_poll(&fd, 1, WAIT_MS) > 0) {
+			int ret = drain();
+
+			if (ret < 0) {
+				return ret;
+			}
+			result->wakeups++;
+		}
+	}
+
+	result->elapsed_ns = MAX(sample_host_time_ns() - start, 1);
+	result->received = rx_packets;
+
+	return rx_bad == 0 ? 0 : -EIO;
+}
+
+static int tcp_setup(void)
+{
+	struct sockaddr_in addr = {
+		.sin_family = AF_INET,
+		.sin_port = htons(TCP_PORT),
+		.sin_addr.s_addr = htonl(INADDR_LOOPBACK),
+	};
+	int one = 1;
+	int server = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+
+	if (server < 0) {
+		return -errno;
+	}
+
+	setsockopt(server, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+	if (bind(server, (struct sockaddr *)&addr, sizeof(addr)) < 0 || listen(server, 1) < 0) {
+		close(server);
+		return -errno;
+	}
+
+	/* The host completes the handshake before accept() */
+	tcp_client = socket(AF_INET, SOCK_STREAM, IPPROTO_TCP);
+	if (tcp_client < 0 || connect(tcp_client, (struct sockaddr *)&addr, sizeof(addr)) < 0) {
+		close(server);
+		return -errno;
+	}
+
+	tcp_conn = accept(server, NULL, NULL);
+	close(server);
+	if (tcp_conn < 0) {
+		return -errno;
+	}
+
+	/* Packets are latency sensitive - no coalescing on the sender */
+	setsockopt(tcp_client, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+
+	return 0;
+}
+
+static int udp_setup(void)
+{
+	struct sockaddr rx_addr = {0};
+	struct sockaddr tx_addr = {0};
+
+	net_sin(&rx_addr)->sin_family = AF_INET;
+	net_sin(&rx_addr)->sin_port = htons(UDP_RX_PORT);
+	net_sin(&rx_addr)->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	net_sin(&tx_addr)->sin_family = AF_INET;
+	net_sin(&tx_addr)->sin_port = htons(UDP_TX_PORT);
+	net_sin(&tx_addr)->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	int ret = weave_packet_udp_open(&udp_rx, &rx_addr, sizeof(struct sockaddr_in));
+
+	if (ret == 0) {
+		ret = weave_packet_udp_open(&udp_tx, &tx_addr, sizeof(struct sockaddr_in));
+	}
+	if (ret == 0) {
+		/* Packets of the benchmark keep client_id 0: sent to every peer */
+		ret = weave_packet_udp_add_peer(&udp_tx, &rx_addr, sizeof(struct sockaddr_in));
+	}
+
+	return ret < 0 ? ret : 0;
+}
+
+static void report(uint16_t len, const struct bench_result *udp, const struct bench_result *tcp)
+{
+	uint32_t udp_rate = (uint64_t)udp->received * NSEC_PER_SEC / udp->elapsed_ns;
+	uint32_t tcp_rate = (uint64_t)tcp->received * NSEC_PER_SEC / tcp->elapsed_ns;
+	uint32_t udp_batch = udp->received * 10 / MAX(udp->wakeups, 1);
+	uint32_t tcp_batch = tcp->received * 10 / MAX(tcp->wakeups, 1);
+
+	LOG_INF("%u bytes: UDP %u packets/s (%u lost, %u.%u per wake-up) | "
+		"TCP %u packets/s (%u.%u per wake-up)",
+		len, udp_rate, BENCH_PACKETS - udp->received, udp_batch / 10, udp_batch % 10,
+		tcp_rate, tcp_batch / 10, tcp_batch % 10);
+}
+
+int main(void)
+{
+	LOG_INF("UDP Transport Sample - %u packets in bursts of %u, UDP vs TCP", BENCH_PACKETS,
+		BENCH_BURST);
+
+	int ret = udp_setup();
+
+	if (ret < 0) {
+		LOG_ERR("Failed to open UDP transports: %d", ret);
+		return ret;
+	}
+
+	ret = tcp_setup();
+	if (ret < 0) {
+		LOG_ERR("Failed to set up TCP connection: %d", ret);
+		return ret;
+	}
+
+	ARRAY_FOR_EACH(bench_sizes, i) {
+		uint16_t len = bench_sizes[i];
+		struct bench_result udp;
+		struct bench_result tcp;
+
+		ret = bench_run(&udp_bench_source, udp_rx.sock, udp_drain, len, &udp);
+		if (ret == 0) {
+			ret = bench_run(&tcp_bench_source, tcp_conn, tcp_drain, len, &tcp);
+		}
+		if (ret < 0 || tcp_tx_errors > 0) {
+			LOG_ERR("Benchmark failed at %u bytes: %d", len, ret);
+			return ret < 0 ? ret : -EIO;
+		}
+
+		report(len, &udp, &tcp);
+	}
+
+	LOG_INF("UDP: %u datagrams sent, %u dropped", (uint32_t)atomic_get(&udp_tx.tx_packets),
+		(uint32_t)atomic_get(&udp_tx.tx_dropped));
+
+	LOG_INF("Sample completed successfully");
+	return 0;
+}
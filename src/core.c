@@ -5,64 +5,912 @@
  */
 
 #include <weave/core.h>
+#ifdef CONFIG_WEAVE_POLL
+#include <weave/poll.h>
+#endif
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/barrier.h>
+#include <string.h>
 
 LOG_MODULE_REGISTER(weave_core, CONFIG_WEAVE_LOG_LEVEL);
 
+/* ============================ Connection Readers ============================ */
+
+#ifdef CONFIG_WEAVE_RUNTIME_CONNECT
+/*
+ * Lock-free traversal of source->sinks with two-phase reader counters.
+ * Readers register on the current epoch's counter; a writer unlinks a
+ * connection, flips the epoch and waits for the old counter to drain
+ * before the connection may be reused (grace period).
+ */
+static atomic_t conn_epoch;
+static atomic_t conn_readers[2];
+/* Serializes list updates */
+static K_MUTEX_DEFINE(conn_mutex);
+/* Serializes grace periods, which sleep */
+static K_MUTEX_DEFINE(conn_sync_mutex);
+
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+/* Traversals the current thread is inside, a grace period would wait on them */
+static __thread int conn_nesting;
+#endif
+
+static inline int conn_read_begin(void)
+{
+	int idx = atomic_get(&conn_epoch) & 1;
+
+	atomic_inc(&conn_readers[idx]);
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+	conn_nesting++;
+#endif
+	return idx;
+}
+
+static inline void conn_read_end(int idx)
+{
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+	conn_nesting--;
+#endif
+	atomic_dec(&conn_readers[idx]);
+}
+
+/**
+ * @brief Check whether the current thread is inside a traversal
+ *
+ * Always false without CONFIG_THREAD_LOCAL_STORAGE.
+ */
+static inline bool conn_in_read(void)
+{
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+	return conn_nesting > 0;
+#else
+	return false;
+#endif
+}
+
+/**
+ * @brief Wait until every traversal that could still see an unlinked node is done
+ *
+ * Flips and drains twice: a reader that sampled the epoch just before
+ * the first flip may register on the old counter only after it was seen
+ * empty, and would then be missed by the next grace period's single
+ * drain. The second flip moves the epoch back, so that reader is on the
+ * current counter and the next grace period waits for it.
+ */
+static void conn_synchronize(void)
+{
+	k_mutex_lock(&conn_sync_mutex, K_FOREVER);
+
+	for (int phase = 0; phase < 2; phase++) {
+		int idx = atomic_inc(&conn_epoch) & 1;
+
+		while (atomic_get(&conn_readers[idx]) != 0) {
+			k_sleep(K_TICKS(1));
+		}
+	}
+
+	k_mutex_unlock(&conn_sync_mutex);
+}
+
+/**
+ * @brief Unlink a node while keeping its next pointer intact
+ *
+ * sys_slist_remove() clears node->next, which would cut short a
+ * concurrent traversal standing on the node. Readers only follow next
+ * pointers, so a single store to the predecessor unpublishes the node.
+ */
+static bool conn_unlink(sys_slist_t *list, sys_snode_t *node)
+{
+	sys_snode_t *prev = NULL;
+	sys_snode_t *cur;
+
+	SYS_SLIST_FOR_EACH_NODE(list, cur) {
+		if (cur == node) {
+			break;
+		}
+		prev = cur;
+	}
+
+	if (cur == NULL) {
+		return false;
+	}
+
+	if (prev == NULL) {
+		list->head = node->next;
+	} else {
+		prev->next = node->next;
+	}
+
+	if (list->tail == node) {
+		list->tail = prev;
+	}
+
+	return true;
+}
+#else
+static inline int conn_read_begin(void)
+{
+	return 0;
+}
+
+static inline void conn_read_end(int idx)
+{
+	ARG_UNUSED(idx);
+}
+#endif /* CONFIG_WEAVE_RUNTIME_CONNECT */
+
 /* ============================ Internal Helpers ============================ */
 
+#ifdef CONFIG_WEAVE_FLOW_CONTROL
+/**
+ * @brief Take one credit for a queued delivery
+ *
+ * @return true if the sink has no flow control or a credit was taken
+ */
+static bool credit_take(struct weave_sink *sink)
+{
+	struct weave_credits *credits = sink->credits;
+
+	if (!credits) {
+		return true;
+	}
+
+	atomic_val_t available;
+
+	do {
+		available = atomic_get(&credits->available);
+		if (available <= 0) {
+			return false;
+		}
+	} while (!atomic_cas(&credits->available, available, available - 1));
+
+	return true;
+}
+
+/**
+ * @brief Return one credit once a queued event is done (or was not queued)
+ */
+static void credit_return(struct weave_sink *sink)
+{
+	if (!sink || !sink->credits) {
+		return;
+	}
+
+	struct weave_credits *credits = sink->credits;
+	atomic_val_t available;
+
+	/* Never above limit - a reset may already have restored this credit */
+	do {
+		available = atomic_get(&credits->available);
+		if (available >= (atomic_val_t)credits->limit) {
+			return;
+		}
+	} while (!atomic_cas(&credits->available, available, available + 1));
+
+	/* Wake a producer waiting on the exhausted pool */
+	if (available == 0) {
+		k_sem_give(&credits->returned);
+	}
+}
+
+static inline bool sink_has_credits(const struct weave_sink *sink)
+{
+	return sink->credits != NULL;
+}
+#else
+static inline bool credit_take(struct weave_sink *sink)
+{
+	ARG_UNUSED(sink);
+	return true;
+}
+
+static inline void credit_return(struct weave_sink *sink)
+{
+	ARG_UNUSED(sink);
+}
+
+static inline bool sink_has_credits(const struct weave_sink *sink)
+{
+	ARG_UNUSED(sink);
+	return false;
+}
+#endif /* CONFIG_WEAVE_FLOW_CONTROL */
+
+/**
+ * @brief Record of a thread currently draining a queue
+ *
+ * Lives on the stack of weave_process_messages() while it runs. Only the
+ * draining thread touches depth, the list itself is protected by drain_lock.
+ */
+struct drain_ctx {
+	sys_snode_t node;
+	struct k_msgq *queue;
+	k_tid_t thread;
+	int depth;
+};
+
+static sys_slist_t drain_list = SYS_SLIST_STATIC_INIT(&drain_list);
+static struct k_spinlock drain_lock;
+
+static void drain_begin(struct drain_ctx *ctx, struct k_msgq *queue)
+{
+	ctx->queue = queue;
+	ctx->thread = k_current_get();
+	ctx->depth = 0;
+
+	K_SPINLOCK(&drain_lock) {
+		sys_slist_prepend(&drain_list, &ctx->node);
+	}
+}
+
+static void drain_end(struct drain_ctx *ctx)
+{
+	K_SPINLOCK(&drain_lock) {
+		sys_slist_find_and_remove(&drain_list, &ctx->node);
+	}
+}
+
+/**
+ * @brief Claim an inline delivery slot for a queue drained by this thread
+ *
+ * @return Drain context with depth taken (release with inline_release),
+ *         or NULL if the delivery must go through the queue
+ */
+static struct drain_ctx *inline_claim(struct k_msgq *queue)
+{
+	struct drain_ctx *found = NULL;
+	struct drain_ctx *ctx;
+
+	if (CONFIG_WEAVE_INLINE_MAX_DEPTH == 0 || !queue || k_is_in_isr()) {
+		return NULL;
+	}
+
+	k_tid_t self = k_current_get();
+
+	K_SPINLOCK(&drain_lock) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&drain_list, ctx, node) {
+			if (ctx->queue == queue && ctx->thread == self) {
+				found = ctx;
+				break;
+			}
+		}
+	}
+
+	if (!found || found->depth >= CONFIG_WEAVE_INLINE_MAX_DEPTH) {
+		return NULL;
+	}
+
+	found->depth++;
+	return found;
+}
+
+static inline void inline_release(struct drain_ctx *ctx)
+{
+	if (ctx) {
+		ctx->depth--;
+	}
+}
+
+
+#ifdef CONFIG_WEAVE_WAKE_MODERATION
+/**
+ * @brief Find the moderation state of a queue (NULL if not moderated)
+ */
+static struct weave_moderation *moderation_find(struct k_msgq *queue)
+{
+	STRUCT_SECTION_FOREACH(weave_moderation, mod) {
+		if (mod->queue == queue) {
+			return mod;
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Look up the moderation state of a sink's queue once
+ *
+ * Done when the sink is connected or first sent to, so enqueueing never
+ * scans the moderation section.
+ */
+static void moderation_resolve(struct weave_sink *sink)
+{
+	if (sink->moderation_resolved) {
+		return;
+	}
+
+	sink->moderation = sink->queue ? moderation_find(sink->queue) : NULL;
+
+	/* Pointer must be visible before the flag that publishes it */
+	barrier_dmem_fence_full();
+	sink->moderation_resolved = true;
+}
+
+/**
+ * @brief Wake the consumer once enough events are pending, or arm the timer
+ */
+static void moderation_notify(const struct weave_sink *sink)
+{
+	struct weave_moderation *mod = sink->moderation;
+
+	if (!mod) {
+		return;
+	}
+
+	atomic_val_t pending = atomic_inc(&mod->pending) + 1;
+
+	if (pending >= mod->max_events) {
+		k_sem_give(&mod->wake);
+	} else if (pending == 1) {
+		k_timer_start(&mod->timer, K_USEC(mod->max_delay_us), K_NO_WAIT);
+	}
+}
+
+static void moderation_expiry(struct k_timer *timer)
+{
+	struct weave_moderation *mod = CONTAINER_OF(timer, struct weave_moderation, timer);
+
+	k_sem_give(&mod->wake);
+}
+#else
+static inline void moderation_resolve(struct weave_sink *sink)
+{
+	ARG_UNUSED(sink);
+}
+
+static inline void moderation_notify(const struct weave_sink *sink)
+{
+	ARG_UNUSED(sink);
+}
+#endif /* CONFIG_WEAVE_WAKE_MODERATION */
+
+#ifdef CONFIG_WEAVE_POLL
+/**
+ * @brief Look up the pollable queue of a sink's queue once
+ *
+ * Like moderation_resolve(), so enqueueing into a queue that is not
+ * pollable costs one pointer test.
+ */
+static void poll_resolve(struct weave_sink *sink)
+{
+	if (sink->poll_resolved) {
+		return;
+	}
+
+	sink->poll = sink->queue ? weave_poll_queue_find(sink->queue) : NULL;
+
+	/* Pointer must be visible before the flag that publishes it */
+	barrier_dmem_fence_full();
+	sink->poll_resolved = true;
+}
+#else
+static inline void poll_resolve(struct weave_sink *sink)
+{
+	ARG_UNUSED(sink);
+}
+#endif /* CONFIG_WEAVE_POLL */
+
+/**
+ * @brief Look up the per-queue state of a sink before it is delivered to
+ */
+static inline void sink_resolve(struct weave_sink *sink)
+{
+	moderation_resolve(sink);
+	poll_resolve(sink);
+}
+
+/**
+ * @brief Put an event into a queue
+ *
+ * Counterpart of queue_get_bulk(): every enqueue goes through here so
+ * moderated queues, work sinks and pollable queues see each event.
+ */
+static int queue_put(struct k_msgq *queue, const struct weave_event *event, k_timeout_t timeout)
+{
+	int ret = k_msgq_put(queue, event, timeout);
+
+	if (ret != 0) {
+		return ret;
+	}
+
+#ifdef CONFIG_WEAVE_WORK_SINK
+	struct weave_sink_work *work = event->sink->work;
+
+	/* Work sinks own their queue, no thread waits on it */
+	if (work) {
+		if (work->work_q) {
+			k_work_submit_to_queue(work->work_q, &work->work);
+		} else {
+			k_work_submit(&work->work);
+		}
+		return 0;
+	}
+#endif
+
+	/* All targets of an event share the leader's queue */
+	moderation_notify(event->sink);
+
+#ifdef CONFIG_WEAVE_POLL
+	if (event->sink->poll) {
+		weave_poll_notify(event->sink->poll);
+	}
+#endif
+
+	return 0;
+}
+
+/**
+ * @brief Check whether a sink is an adaptive sink
+ */
+static inline bool sink_is_adaptive(const struct weave_sink *sink)
+{
+	return sink->handler == weave_adaptive_dispatch;
+}
+
+/**
+ * @brief Release a reference taken by ops->ref for a sink
+ */
+static inline void payload_release(const struct weave_payload_ops *ops, void *ptr,
+				   struct weave_sink *sink)
+{
+	if (!ops) {
+		return;
+	}
+
+	if (ops->release) {
+		ops->release(ptr, sink);
+	} else if (ops->unref) {
+		ops->unref(ptr);
+	}
+}
+
+/**
+ * @brief Check whether a delivery to a sink runs in the producer
+ *
+ * True for immediate sinks and for adaptive sinks currently in immediate
+ * mode. Adaptive sinks always defer from ISRs.
+ */
+static inline bool sink_is_immediate(const struct weave_sink *sink)
+{
+	if (sink->queue == NULL) {
+		return true;
+	}
+
+	return sink_is_adaptive(sink) && !k_is_in_isr() &&
+	       !weave_adaptive_sink_is_deferred(sink->user_data);
+}
+
+/**
+ * @brief Deliver a message to a single sink with lifecycle management
+ *
+ * Handles ref (with optional filtering) and unref for both immediate and queued modes.
+ * For immediate (or a queue drained by the calling thread): calls handler then unref.
+ * For queued: stores ops in event, unref happens later in weave_process_messages.
+ *
+ * @return 0 on success, -EACCES if filtered, -ENOBUFS if queue full
+ */
+static int sink_deliver(struct weave_sink *sink, void *ptr, const struct weave_payload_ops *ops,
+			k_timeout_t timeout)
+{
+	if (!sink || !sink->handler || !ptr) {
+		return -EINVAL;
+	}
+
+	if (ops && ops->filter) {
+		int ret = ops->filter(ptr, sink);
+		if (ret < 0) {
+			return ret; /* Filtered out */
+		}
+	}
+
+	/* Take reference (and optionally filter) before delivery */
+	if (ops && ops->ref) {
+		int ret = ops->ref(ptr, sink);
+		if (ret < 0) {
+			return ret; /* Filtered out or error */
+		}
+	}
+
+	/* Queued sinks run inline when this thread is the one draining their queue */
+	struct drain_ctx *inline_ctx = inline_claim(sink->queue);
+
+	if (sink_is_immediate(sink) || inline_ctx) {
+		/* Immediate mode - call handler directly */
+		sink->handler(ptr, sink->user_data);
+		inline_release(inline_ctx);
+		/* Release reference after immediate handling */
+		payload_release(ops, ptr, sink);
+		return 0;
+	}
+
+	/* Queued mode - put event in queue with ops for later unref */
+	struct weave_event event = {
+		.sink = sink,
+		.ptr = ptr,
+		.ops = ops,
+	};
+
+	if (!credit_take(sink)) {
+		payload_release(ops, ptr, sink);
+		LOG_DBG("Out of credits, dropped message");
+		return -ENOBUFS;
+	}
+
+	int ret = queue_put(sink->queue, &event, timeout);
+	if (ret != 0) {
+		credit_return(sink);
+		/* Release reference on failure */
+		payload_release(ops, ptr, sink);
+		LOG_DBG("Queue full, dropped message");
+		return -ENOBUFS;
+	}
+
+	return 0;
+}
+
+#if CONFIG_WEAVE_VALUE_MAX_SIZE > 0
+/** Marks events whose payload is the inline value copy (no lifecycle) */
+static const struct weave_payload_ops value_ops;
+
+/**
+ * @brief Deliver a copy of a by-value message to a single sink
+ *
+ * @return 0 on success, -EINVAL on bad sink, -ENOBUFS if queue full
+ */
+static int value_deliver(struct weave_sink *sink, const void *value, size_t size,
+			 k_timeout_t timeout)
+{
+	if (!sink || !sink->handler) {
+		return -EINVAL;
+	}
+
+	struct drain_ctx *inline_ctx = inline_claim(sink->queue);
+
+	if (sink_is_immediate(sink) || inline_ctx) {
+		/* Immediate mode - handler gets its own copy on the stack */
+		uint8_t copy[CONFIG_WEAVE_VALUE_MAX_SIZE] __aligned(8);
+
+		memcpy(copy, value, size);
+		sink->handler(copy, sink->user_data);
+		inline_release(inline_ctx);
+		return 0;
+	}
+
+	/* Queued mode - the copy travels inside the event */
+	struct weave_event event = {
+		.sink = sink,
+		.ops = &value_ops,
+	};
+
+	memcpy(event.value, value, size);
+
+	if (!credit_take(sink)) {
+		LOG_DBG("Out of credits, dropped message");
+		return -ENOBUFS;
+	}
+
+	if (queue_put(sink->queue, &event, timeout) != 0) {
+		credit_return(sink);
+		LOG_DBG("Queue full, dropped message");
+		return -ENOBUFS;
+	}
+
+	return 0;
+}
+#endif /* CONFIG_WEAVE_VALUE_MAX_SIZE > 0 */
+
+#if CONFIG_WEAVE_EVENT_MAX_TARGETS > 1
+/**
+ * @brief Check whether a queue is being drained by the calling thread
+ */
+static bool queue_drained_here(struct k_msgq *queue)
+{
+	struct drain_ctx *ctx = inline_claim(queue);
+
+	inline_release(ctx);
+	return ctx != NULL;
+}
+
+/**
+ * @brief Check whether a sink takes part in multi-target events
+ *
+ * Adaptive sinks decide per delivery and flow-controlled sinks account
+ * credits per event, so both always get their own event.
+ */
+static inline bool sink_groupable(const struct weave_sink *sink)
+{
+	return sink && sink->queue && sink->handler && !sink_is_adaptive(sink) &&
+	       !sink_has_credits(sink);
+}
+
+/**
+ * @brief Check whether queued sinks of a source can share one reference
+ *
+ * Sharing is only safe when ref does not filter: either a dedicated
+ * filter callback exists, or there is no ref at all.
+ */
+static inline bool ops_share_ref(const struct weave_payload_ops *ops)
+{
+	return ops && (ops->filter || !ops->ref);
+}
+
+/* Distinct shared queues one emit remembers; further queues are looked up */
+#define EMIT_GROUPED_MAX 8
+
+/**
+ * @brief Queues already served by group_deliver() during one emit
+ */
+struct emit_grouped {
+	struct k_msgq *queues[EMIT_GROUPED_MAX];
+	size_t count;
+};
+
+/**
+ * @brief Check whether a queue was already served by an earlier connection
+ *
+ * Only used once more than EMIT_GROUPED_MAX queues were grouped.
+ */
+static bool queue_seen_before(struct weave_source *source, struct weave_connection *until)
+{
+	struct weave_connection *conn;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&source->sinks, conn, node) {
+		if (conn == until) {
+			break;
+		}
+		if (sink_groupable(conn->sink) && conn->sink->queue == until->sink->queue) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/**
+ * @brief Mark the queue of a connection as grouped
+ *
+ * @return true if an earlier connection of this emit already grouped it
+ */
+static bool queue_mark_grouped(struct emit_grouped *grouped, struct weave_source *source,
+			       struct weave_connection *conn)
+{
+	struct k_msgq *queue = conn->sink->queue;
+
+	for (size_t i = 0; i < grouped->count; i++) {
+		if (grouped->queues[i] == queue) {
+			return true;
+		}
+	}
+
+	if (grouped->count < EMIT_GROUPED_MAX) {
+		grouped->queues[grouped->count++] = queue;
+		return false;
+	}
+
+	return queue_seen_before(source, conn);
+}
+
+/**
+ * @brief Put a multi-target event into its queue with a single reference
+ *
+ * @return Number of targets delivered (0 if ref failed or queue full)
+ */
+static int group_flush(struct weave_event *event, size_t count, k_timeout_t timeout)
+{
+	const struct weave_payload_ops *ops = event->ops;
+
+	if (ops->ref && ops->ref(event->ptr, event->sink) < 0) {
+		return 0;
+	}
+
+	if (queue_put(event->sink->queue, event, timeout) != 0) {
+		payload_release(ops, event->ptr, event->sink);
+		LOG_DBG("Queue full, dropped message");
+		return 0;
+	}
+
+	return count;
+}
+
+/**
+ * @brief Deliver to every sink of a source that shares the leader's queue
+ *
+ * Walks the connections starting at the leader, filters each sink sharing
+ * the queue, and packs accepted sinks into as few events as possible.
+ *
+ * @return Number of sinks delivered
+ */
+static int group_deliver(struct weave_source *source, struct weave_connection *leader, void *ptr,
+			 k_timepoint_t deadline)
+{
+	const struct weave_payload_ops *ops = source->ops;
+	struct k_msgq *queue = leader->sink->queue;
+	struct weave_event event = {.ptr = ptr, .ops = ops};
+	struct weave_connection *conn;
+	size_t count = 0;
+	int delivered = 0;
+
+	for (conn = leader; conn; conn = SYS_SLIST_PEEK_NEXT_CONTAINER(conn, node)) {
+		struct weave_sink *sink = conn->sink;
+
+		if (!sink_groupable(sink) || sink->queue != queue) {
+			continue;
+		}
+		if (ops->filter && ops->filter(ptr, sink) < 0) {
+			continue;
+		}
+
+		if (count == 0) {
+			event.sink = sink;
+		} else {
+			event.more[count - 1] = sink;
+		}
+
+		if (++count == CONFIG_WEAVE_EVENT_MAX_TARGETS) {
+			delivered += group_flush(&event, count, sys_timepoint_timeout(deadline));
+			memset(event.more, 0, sizeof(event.more));
+			count = 0;
+		}
+	}
+
+	if (count > 0) {
+		delivered += group_flush(&event, count, sys_timepoint_timeout(deadline));
+	}
+
+	return delivered;
+}
+#endif /* CONFIG_WEAVE_EVENT_MAX_TARGETS > 1 */
+
+/**
+ * @brief Copy up to max queued events out of a queue under one lock hold
+ *
+ * k_msgq has no multi-message get, so this reads its ring directly.
+ * Writers only block on a full queue, where k_msgq_get() hands the freed
+ * slot to one of them; a full queue is therefore left to k_msgq_get().
+ *
+ * @return Number of events copied (0 if the queue is empty or full)
+ */
+static size_t msgq_copy_out(struct k_msgq *queue, struct weave_event *events, size_t max)
+{
+	size_t count = 0;
+
+	__ASSERT(queue->msg_size == sizeof(struct weave_event), "Not a weave queue");
+
+	K_SPINLOCK(&queue->lock) {
+		/* Writers may be waiting on a full queue */
+		if (queue->used_msgs < queue->max_msgs) {
+			count = MIN(max, queue->used_msgs);
+		}
+
+		for (size_t i = 0; i < count; i++) {
+			memcpy(&events[i], queue->read_ptr, sizeof(struct weave_event));
+			queue->read_ptr += sizeof(struct weave_event);
+			if (queue->read_ptr == queue->buffer_end) {
+				queue->read_ptr = queue->buffer_start;
+			}
+		}
+		queue->used_msgs -= count;
+	}
+
+	return count;
+}
+
+/**
+ * @brief Dequeue up to max events from a queue
+ *
+ * Takes whatever is already queued with one lock hold. Only if the queue
+ * is empty (or full, see msgq_copy_out()) does it wait up to timeout in
+ * k_msgq_get() for the first event and then copy out the rest.
+ *
+ * @return Number of events stored in events
+ */
+static size_t queue_get_bulk(struct k_msgq *queue, struct weave_event *events, size_t max,
+			     k_timeout_t timeout)
+{
+	size_t count = msgq_copy_out(queue, events, max);
+
+	if (count == 0) {
+		if (k_msgq_get(queue, &events[0], timeout) != 0) {
+			return 0;
+		}
+
+		count = 1 + msgq_copy_out(queue, &events[1], max - 1);
+	}
+
+#if CONFIG_WEAVE_VALUE_MAX_SIZE > 0
+	/* By-value payloads are handed out from the dequeued copy */
+	for (size_t i = 0; i < count; i++) {
+		if (events[i].ops == &value_ops) {
+			events[i].ptr = events[i].value;
+		}
+	}
+#endif
+
+	return count;
+}
+
 /**
- * @brief Deliver a message to a single sink with lifecycle management
+ * @brief Run the handlers of a dequeued event and release its reference
  *
- * Handles ref (with optional filtering) and unref for both immediate and queued modes.
- * For immediate: calls handler then unref.
- * For queued: stores ops in event, unref happens later in weave_process_messages.
- *
- * @return 0 on success, -EACCES if filtered, -ENOBUFS if queue full
+ * @return Number of handlers invoked
  */
-static int sink_deliver(struct weave_sink *sink, void *ptr, const struct weave_payload_ops *ops,
-			k_timeout_t timeout)
+static int event_dispatch(struct weave_event *event)
 {
-	if (!sink || !sink->handler || !ptr) {
-		return -EINVAL;
+	struct weave_sink *sink = event->sink;
+	int handled = 0;
+
+	if (sink && sink->handler) {
+		sink->handler(event->ptr, sink->user_data);
+		handled++;
 	}
 
-	/* Take reference (and optionally filter) before delivery */
-	if (ops && ops->ref) {
-		int ret = ops->ref(ptr, sink);
-		if (ret < 0) {
-			return ret; /* Filtered out or error */
+#if CONFIG_WEAVE_EVENT_MAX_TARGETS > 1
+	/* Remaining targets share the event's single reference */
+	for (size_t i = 0; i < ARRAY_SIZE(event->more) && event->more[i]; i++) {
+		sink = event->more[i];
+		if (sink->handler) {
+			sink->handler(event->ptr, sink->user_data);
+			handled++;
 		}
 	}
+#endif
 
-	if (sink->queue == NULL) {
-		/* Immediate mode - call handler directly */
-		sink->handler(ptr, sink->user_data);
-		/* Release reference after immediate handling */
-		if (ops && ops->unref) {
-			ops->unref(ptr);
-		}
+	/* Use event's ops for unref (same ops that did ref, for the leading sink) */
+	if (handled > 0) {
+		payload_release(event->ops, event->ptr, event->sink);
+	}
+
+	return handled;
+}
+
+/**
+ * @brief Check whether an event targets exactly one sink
+ */
+static inline bool event_single_target(const struct weave_event *event)
+{
+#if CONFIG_WEAVE_EVENT_MAX_TARGETS > 1
+	return event->more[0] == NULL;
+#else
+	ARG_UNUSED(event);
+	return true;
+#endif
+}
+
+/**
+ * @brief Hand a run of consecutive events to a batch sink in one call
+ *
+ * Gathers events[0..] while they target only the same batch sink, up to
+ * its max_batch, calls the batch handler once and then releases all
+ * references.
+ *
+ * @return Number of events consumed (0 if events[0] is not batchable)
+ */
+static size_t batch_dispatch_run(struct weave_event *events, size_t count)
+{
+	struct weave_sink *sink = events[0].sink;
+
+	if (!sink || sink->handler != weave_batch_dispatch || !event_single_target(&events[0])) {
 		return 0;
 	}
 
-	/* Queued mode - put event in queue with ops for later unref */
-	struct weave_event event = {
-		.sink = sink,
-		.ptr = ptr,
-		.ops = ops,
-	};
+	struct weave_batch_sink *batch = sink->user_data;
+	void *ptrs[CONFIG_WEAVE_PROCESS_BATCH_SIZE];
+	size_t max = MIN(count, batch->max_batch);
+	size_t n = 0;
 
-	int ret = k_msgq_put(sink->queue, &event, timeout);
-	if (ret != 0) {
-		/* Release reference on failure */
-		if (ops && ops->unref) {
-			ops->unref(ptr);
-		}
-		LOG_DBG("Queue full, dropped message");
-		return -ENOBUFS;
+	while (n < max && events[n].sink == sink && event_single_target(&events[n])) {
+		ptrs[n] = events[n].ptr;
+		n++;
 	}
 
-	return 0;
+	batch->handler(ptrs, n, batch->user_data);
+
+	/* Release references in bulk once the handler is done with all of them */
+	for (size_t i = 0; i < n; i++) {
+		payload_release(events[i].ops, events[i].ptr, events[i].sink);
+	}
+
+	return n;
 }
 
 /* ============================ Public API ============================ */
@@ -79,11 +927,30 @@ int weave_source_emit(struct weave_source *source, void *ptr, k_timeout_t timeou
 
 	LOG_DBG("emit: source=%p, sinks empty=%d", source, sys_slist_is_empty(&source->sinks));
 
+#if CONFIG_WEAVE_EVENT_MAX_TARGETS > 1
+	struct emit_grouped grouped = {.count = 0};
+#endif
+	int epoch = conn_read_begin();
+
 	SYS_SLIST_FOR_EACH_CONTAINER(&source->sinks, conn, node) {
 		/* Without ops, we can only deliver to one sink (no ref counting) */
 		if (!source->ops && delivered > 0) {
-			return -EINVAL;
+			delivered = -EINVAL;
+			break;
+		}
+
+#if CONFIG_WEAVE_EVENT_MAX_TARGETS > 1
+		/* Sinks sharing a queue get one event per queue, led by the first one.
+		 * Queues drained by this thread are left to sink_deliver() to run inline.
+		 */
+		if (ops_share_ref(source->ops) && sink_groupable(conn->sink) &&
+		    !queue_drained_here(conn->sink->queue)) {
+			if (!queue_mark_grouped(&grouped, source, conn)) {
+				delivered += group_deliver(source, conn, ptr, deadline);
+			}
+			continue;
 		}
+#endif
 
 		k_timeout_t remaining = sys_timepoint_timeout(deadline);
 		int ret = sink_deliver(conn->sink, ptr, source->ops, remaining);
@@ -92,11 +959,72 @@ int weave_source_emit(struct weave_source *source, void *ptr, k_timeout_t timeou
 		}
 	}
 
+	conn_read_end(epoch);
+
 	LOG_DBG("Emitted to %d sinks", delivered);
 
 	return delivered;
 }
 
+bool weave_source_would_deliver(struct weave_source *source, const void *key)
+{
+	if (!source) {
+		return false;
+	}
+
+	const struct weave_payload_ops *ops = source->ops;
+	struct weave_connection *conn;
+	bool found = false;
+	int epoch = conn_read_begin();
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&source->sinks, conn, node) {
+		if (!conn->sink || !conn->sink->handler) {
+			continue;
+		}
+		if (!key || !ops || !ops->accepts || ops->accepts(key, conn->sink)) {
+			found = true;
+			break;
+		}
+	}
+
+	conn_read_end(epoch);
+
+	return found;
+}
+
+int weave_source_emit_lazy(struct weave_source *source, const void *key, weave_producer_t produce,
+			   void *user_data, k_timeout_t timeout)
+{
+	if (!source || !produce) {
+		return -EINVAL;
+	}
+
+	if (!weave_source_would_deliver(source, key)) {
+		return 0;
+	}
+
+	void *ptr = NULL;
+	int ret = produce(&ptr, user_data);
+
+	if (ret < 0) {
+		return ret;
+	}
+	if (!ptr) {
+		return -EINVAL;
+	}
+
+	ret = weave_source_emit(source, ptr, timeout);
+
+	/* Drop the producer's reference, unless it was handed over to a sink */
+	const struct weave_payload_ops *ops = source->ops;
+
+	if (ops && ops->unref && (ops->ref || ret <= 0)) {
+		ops->unref(ptr);
+	}
+
+	return ret;
+}
+
 int weave_sink_send(struct weave_sink *sink, void *ptr, const struct weave_payload_ops *ops,
 		    k_timeout_t timeout)
 {
@@ -104,9 +1032,68 @@ int weave_sink_send(struct weave_sink *sink, void *ptr, const struct weave_paylo
 		return -EINVAL;
 	}
 
+	sink_resolve(sink);
+
 	return sink_deliver(sink, ptr, ops, timeout);
 }
 
+int weave_source_emit_value(struct weave_source *source, const void *value, size_t size,
+			    k_timeout_t timeout)
+{
+	if (!source || !value || size == 0) {
+		return -EINVAL;
+	}
+
+	if (size > CONFIG_WEAVE_VALUE_MAX_SIZE) {
+		return -EMSGSIZE;
+	}
+
+#if CONFIG_WEAVE_VALUE_MAX_SIZE > 0
+	k_timepoint_t deadline = sys_timepoint_calc(timeout);
+	int delivered = 0;
+	struct weave_connection *conn;
+
+	int epoch = conn_read_begin();
+
+	/* Plain copy per sink - no ops, so no single-sink restriction */
+	SYS_SLIST_FOR_EACH_CONTAINER(&source->sinks, conn, node) {
+		k_timeout_t remaining = sys_timepoint_timeout(deadline);
+
+		if (value_deliver(conn->sink, value, size, remaining) == 0) {
+			delivered++;
+		}
+	}
+
+	conn_read_end(epoch);
+
+	return delivered;
+#else
+	ARG_UNUSED(timeout);
+	return -EMSGSIZE;
+#endif
+}
+
+int weave_sink_send_value(struct weave_sink *sink, const void *value, size_t size,
+			  k_timeout_t timeout)
+{
+	if (!sink || !value || size == 0) {
+		return -EINVAL;
+	}
+
+	if (size > CONFIG_WEAVE_VALUE_MAX_SIZE) {
+		return -EMSGSIZE;
+	}
+
+#if CONFIG_WEAVE_VALUE_MAX_SIZE > 0
+	sink_resolve(sink);
+
+	return value_deliver(sink, value, size, timeout);
+#else
+	ARG_UNUSED(timeout);
+	return -EMSGSIZE;
+#endif
+}
+
 int weave_process_messages(struct k_msgq *queue, k_timeout_t timeout)
 {
 	if (!queue) {
@@ -114,31 +1101,307 @@ int weave_process_messages(struct k_msgq *queue, k_timeout_t timeout)
 	}
 
 	int processed = 0;
-	struct weave_event event;
+	struct weave_event events[CONFIG_WEAVE_PROCESS_BATCH_SIZE];
 	k_timepoint_t deadline = sys_timepoint_calc(timeout);
+	struct drain_ctx drain;
+	size_t count;
+
+	/* Advertise this thread as the queue's consumer for inline delivery */
+	if (CONFIG_WEAVE_INLINE_MAX_DEPTH > 0) {
+		drain_begin(&drain, queue);
+	}
 
 	/* Wait for first message with caller's timeout, then drain remaining */
 	k_timeout_t remaining = sys_timepoint_timeout(deadline);
-	while (k_msgq_get(queue, &event, remaining) == 0) {
-		struct weave_sink *sink = event.sink;
+	while ((count = queue_get_bulk(queue, events, ARRAY_SIZE(events), remaining)) > 0) {
+		/* Dispatch the whole batch back-to-back */
+		for (size_t i = 0; i < count;) {
+			size_t batched = batch_dispatch_run(&events[i], count - i);
 
-		if (sink && sink->handler) {
-			sink->handler(event.ptr, sink->user_data);
+			if (batched > 0) {
+				processed += batched;
+			} else {
+				processed += event_dispatch(&events[i]);
+				batched = 1;
+			}
 
-			/* Use event's ops for unref (same ops that did ref) */
-			if (event.ops && event.ops->unref) {
-				event.ops->unref(event.ptr);
+			/* Handlers are done with these events, hand their credits back */
+			for (size_t j = i; j < i + batched; j++) {
+				credit_return(events[j].sink);
 			}
-			processed++;
+			i += batched;
 		}
 
 		/* Use remaining time for subsequent messages */
 		remaining = sys_timepoint_timeout(deadline);
 	}
 
+	if (CONFIG_WEAVE_INLINE_MAX_DEPTH > 0) {
+		drain_end(&drain);
+	}
+
 	return processed;
 }
 
+void weave_batch_dispatch(void *ptr, void *user_data)
+{
+	struct weave_batch_sink *batch = (struct weave_batch_sink *)user_data;
+
+	if (!batch || !batch->handler) {
+		return;
+	}
+
+	batch->handler(&ptr, 1, batch->user_data);
+}
+
+/** Weight of the newest sample in the adaptive moving average (1/2^n) */
+#define ADAPTIVE_AVG_SHIFT 3
+
+void weave_adaptive_dispatch(void *ptr, void *user_data)
+{
+	struct weave_adaptive_sink *adaptive = (struct weave_adaptive_sink *)user_data;
+
+	if (!adaptive || !adaptive->handler) {
+		return;
+	}
+
+	uint32_t start = k_cycle_get_32();
+
+	adaptive->handler(ptr, adaptive->user_data);
+
+	uint32_t elapsed = k_cyc_to_ns_floor32(k_cycle_get_32() - start);
+	uint32_t avg = adaptive->avg_ns;
+
+	/* Concurrent updates may lose a sample, which only slows adaptation */
+	if (avg == 0) {
+		avg = elapsed;
+	} else {
+		avg = avg - (avg >> ADAPTIVE_AVG_SHIFT) + (elapsed >> ADAPTIVE_AVG_SHIFT);
+	}
+	adaptive->avg_ns = avg;
+
+	if (avg > adaptive->defer_ns) {
+		if (atomic_cas(&adaptive->deferred, 0, 1)) {
+			LOG_DBG("Adaptive sink %p deferred (avg %u ns)", adaptive, avg);
+		}
+	} else if (avg < adaptive->inline_ns) {
+		if (atomic_cas(&adaptive->deferred, 1, 0)) {
+			LOG_DBG("Adaptive sink %p immediate (avg %u ns)", adaptive, avg);
+		}
+	}
+}
+
+#ifdef CONFIG_WEAVE_WORK_SINK
+void weave_sink_work_handler(struct k_work *work)
+{
+	struct weave_sink_work *sink_work = CONTAINER_OF(work, struct weave_sink_work, work);
+
+	/* Events put while this runs resubmit the work item */
+	weave_process_messages(sink_work->queue, K_NO_WAIT);
+}
+#endif /* CONFIG_WEAVE_WORK_SINK */
+
+/* ============================ Wake Moderation ============================ */
+
+#ifdef CONFIG_WEAVE_WAKE_MODERATION
+int weave_process_moderated(struct weave_moderation *mod, k_timeout_t timeout)
+{
+	if (!mod || !mod->queue) {
+		return -EINVAL;
+	}
+
+	if (k_sem_take(&mod->wake, timeout) != 0) {
+		return 0;
+	}
+
+	/* Events queued from here on start a new moderation window */
+	k_timer_stop(&mod->timer);
+	atomic_clear(&mod->pending);
+
+	return weave_process_messages(mod->queue, K_NO_WAIT);
+}
+#endif /* CONFIG_WEAVE_WAKE_MODERATION */
+
+int weave_source_emit_urgent(struct weave_source *source, void *ptr, k_timeout_t timeout)
+{
+	int ret = weave_source_emit(source, ptr, timeout);
+
+#ifdef CONFIG_WEAVE_WAKE_MODERATION
+	if (ret > 0) {
+		struct weave_connection *conn;
+		int epoch = conn_read_begin();
+
+		SYS_SLIST_FOR_EACH_CONTAINER(&source->sinks, conn, node) {
+			struct weave_moderation *mod = conn->sink ? conn->sink->moderation : NULL;
+
+			if (mod && atomic_get(&mod->pending) > 0) {
+				k_sem_give(&mod->wake);
+			}
+		}
+
+		conn_read_end(epoch);
+	}
+#endif
+
+	return ret;
+}
+
+/* ============================ Flow Control ============================ */
+
+#ifdef CONFIG_WEAVE_FLOW_CONTROL
+int weave_sink_credits(const struct weave_sink *sink)
+{
+	if (!sink || !sink->credits) {
+		return INT_MAX;
+	}
+
+	return (int)atomic_get(&sink->credits->available);
+}
+
+int weave_source_credits(struct weave_source *source)
+{
+	if (!source) {
+		return INT_MAX;
+	}
+
+	struct weave_connection *conn;
+	int credits = INT_MAX;
+	int epoch = conn_read_begin();
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&source->sinks, conn, node) {
+		if (conn->sink) {
+			credits = MIN(credits, weave_sink_credits(conn->sink));
+		}
+	}
+
+	conn_read_end(epoch);
+
+	return credits;
+}
+
+int weave_source_wait_credits(struct weave_source *source, k_timeout_t timeout)
+{
+	if (!source) {
+		return -EINVAL;
+	}
+
+	k_timepoint_t deadline = sys_timepoint_calc(timeout);
+	struct weave_connection *conn;
+	int ret = 0;
+	int epoch = conn_read_begin();
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&source->sinks, conn, node) {
+		struct weave_credits *credits = conn->sink ? conn->sink->credits : NULL;
+
+		if (!credits) {
+			continue;
+		}
+
+		while (atomic_get(&credits->available) <= 0) {
+			if (k_sem_take(&credits->returned, sys_timepoint_timeout(deadline)) != 0) {
+				ret = -EAGAIN;
+				break;
+			}
+		}
+
+		if (ret != 0) {
+			break;
+		}
+
+		/* Pass the wakeup on to other producers waiting on this sink */
+		if (k_sem_count_get(&credits->returned) == 0 &&
+		    atomic_get(&credits->available) > 0) {
+			k_sem_give(&credits->returned);
+		}
+	}
+
+	conn_read_end(epoch);
+
+	return ret;
+}
+
+void weave_sink_credits_reset(struct weave_sink *sink)
+{
+	if (!sink || !sink->credits) {
+		return;
+	}
+
+	atomic_set(&sink->credits->available, sink->credits->limit);
+	k_sem_give(&sink->credits->returned);
+}
+#endif /* CONFIG_WEAVE_FLOW_CONTROL */
+
+/* ============================ Runtime Wiring ============================ */
+
+#ifdef CONFIG_WEAVE_RUNTIME_CONNECT
+int weave_connect(struct weave_connection *conn, struct weave_source *source,
+		  struct weave_sink *sink)
+{
+	if (!conn || !source || !sink) {
+		return -EINVAL;
+	}
+
+	int ret = 0;
+
+	k_mutex_lock(&conn_mutex, K_FOREVER);
+
+	if (conn->source) {
+		ret = -EALREADY;
+	} else {
+		conn->source = source;
+		conn->sink = sink;
+		conn->node.next = NULL;
+		sink_resolve(sink);
+
+		/* Node must be complete before a reader can reach it */
+		barrier_dmem_fence_full();
+		sys_slist_append(&source->sinks, &conn->node);
+		LOG_DBG("Connected: source=%p -> sink=%p", source, sink);
+	}
+
+	k_mutex_unlock(&conn_mutex);
+
+	return ret;
+}
+
+int weave_disconnect(struct weave_connection *conn)
+{
+	if (!conn || !conn->source) {
+		return -EINVAL;
+	}
+
+	if (k_is_in_isr()) {
+		return -EWOULDBLOCK;
+	}
+
+	/* Called from a handler: the grace period would wait for our own emit */
+	if (conn_in_read()) {
+		return -EDEADLK;
+	}
+
+	k_mutex_lock(&conn_mutex, K_FOREVER);
+	bool unlinked = conn_unlink(&conn->source->sinks, &conn->node);
+	k_mutex_unlock(&conn_mutex);
+
+	if (!unlinked) {
+		return -ENOENT;
+	}
+
+	/* Wait out emits that may still be walking over the node. conn->source
+	 * stays set meanwhile, so the connection cannot be reconnected early.
+	 */
+	conn_synchronize();
+
+	k_mutex_lock(&conn_mutex, K_FOREVER);
+	LOG_DBG("Disconnected: source=%p -> sink=%p", conn->source, conn->sink);
+	conn->node.next = NULL;
+	conn->source = NULL;
+	k_mutex_unlock(&conn_mutex);
+
+	return 0;
+}
+#endif /* CONFIG_WEAVE_RUNTIME_CONNECT */
+
 /* ============================ Initialization ============================ */
 
 /**
@@ -155,11 +1418,18 @@ static int weave_init(void)
 			continue;
 		}
 
+		sink_resolve(conn->sink);
 		sys_slist_append(&conn->source->sinks, &conn->node);
 		LOG_DBG("Wired: source=%p -> sink=%p", conn->source, conn->sink);
 		count++;
 	}
 
+#ifdef CONFIG_WEAVE_WAKE_MODERATION
+	STRUCT_SECTION_FOREACH(weave_moderation, mod) {
+		k_timer_init(&mod->timer, moderation_expiry, NULL);
+	}
+#endif
+
 	LOG_DBG("Weave initialized with %d connections", count);
 	return 0;
 }
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <weave/obj_pool.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(weave_obj_pool, CONFIG_WEAVE_LOG_LEVEL);
+
+/* ============================ Object API ============================ */
+
+void *weave_obj_alloc(struct weave_obj_pool *pool, k_timeout_t timeout)
+{
+	void *block;
+
+	if (!pool || !pool->slab) {
+		return NULL;
+	}
+
+	if (k_mem_slab_alloc(pool->slab, &block, timeout) != 0) {
+		LOG_DBG("Object pool %p exhausted", pool);
+		return NULL;
+	}
+
+	void *obj = (uint8_t *)block + pool->hdr_size;
+	struct weave_obj_hdr *hdr = (struct weave_obj_hdr *)obj - 1;
+
+	atomic_set(&hdr->refcount, 1);
+	return obj;
+}
+
+void weave_obj_unref(struct weave_obj_pool *pool, void *obj)
+{
+	if (!pool || !obj) {
+		return;
+	}
+
+	struct weave_obj_hdr *hdr = (struct weave_obj_hdr *)obj - 1;
+	atomic_val_t prev = atomic_dec(&hdr->refcount);
+
+	__ASSERT(prev > 0, "Object %p released more often than referenced", obj);
+
+	if (prev == 1) {
+		k_mem_slab_free(pool->slab, (uint8_t *)obj - pool->hdr_size);
+	}
+}
+
+/* ============================ Payload Ops ============================ */
+
+int weave_obj_ops_ref(void *ptr, struct weave_sink *sink)
+{
+	ARG_UNUSED(sink);
+
+	weave_obj_ref(ptr);
+	return 0;
+}
@@ -12,22 +12,26 @@
 #include <weave/packet.h>
 #include <zephyr/logging/log.h>
 
+#ifdef CONFIG_WEAVE_PACKET_ACCOUNTING
+#include <weave/packet_account.h>
+#endif
+
 LOG_MODULE_REGISTER(weave_packet, CONFIG_WEAVE_LOG_LEVEL);
 
 /* ============================ net_buf Payload Ops ============================ */
 
 /**
- * @brief Reference callback with optional ID filtering
+ * @brief Filter callback for ID-based filtering
  *
  * Filtering logic:
  * - If ctx->filter != WEAVE_PACKET_ID_ANY (0xFF), only packets with
  *   matching packet_id are accepted.
  * - If ctx->filter == WEAVE_PACKET_ID_ANY or packet has ID_ANY, all packets pass.
  */
-static int packet_buf_ref(void *ptr, struct weave_sink *sink)
+static int packet_buf_filter(void *ptr, struct weave_sink *sink)
 {
 	struct net_buf *buf = (struct net_buf *)ptr;
-	struct weave_packet_sink_ctx *ctx = (struct weave_packet_sink_ctx *)sink->user_data;
+	struct weave_packet_sink_ctx *ctx = weave_sink_context(sink);
 
 	/* Check if sink has a filter */
 	if (ctx && ctx->filter != WEAVE_PACKET_ID_ANY) {
@@ -40,6 +44,56 @@ static int packet_buf_ref(void *ptr, struct weave_sink *sink)
 		}
 	}
 
+	return 0;
+}
+
+/**
+ * @brief Payload-free filter for weave_source_would_deliver()
+ *
+ * Same rule as packet_buf_filter(), with key pointing to a packet ID.
+ */
+static bool packet_id_accepts(const void *key, const struct weave_sink *sink)
+{
+	const struct weave_packet_sink_ctx *ctx = weave_sink_context(sink);
+	uint8_t packet_id = *(const uint8_t *)key;
+
+	return !ctx || ctx->filter == WEAVE_PACKET_ID_ANY || packet_id == WEAVE_PACKET_ID_ANY ||
+	       packet_id == ctx->filter;
+}
+
+#ifdef CONFIG_WEAVE_PACKET_ACCOUNTING
+/**
+ * @brief Count a sink reference for its holder
+ *
+ * References of queued sinks are held by their queue until processed,
+ * those of immediate sinks by the sink while its handler runs.
+ */
+static void packet_buf_account(struct net_buf *buf, struct weave_sink *sink, bool hold)
+{
+	if (sink->queue) {
+		weave_packet_account(buf, sink->queue, WEAVE_PACKET_HOLDER_QUEUE, hold);
+	} else {
+		weave_packet_account(buf, sink, WEAVE_PACKET_HOLDER_HANDLER, hold);
+	}
+}
+#endif
+
+/**
+ * @brief Reference callback
+ *
+ * Filtering is done separately in packet_buf_filter(), which lets queued
+ * sinks sharing a queue share a single reference.
+ */
+static int packet_buf_ref(void *ptr, struct weave_sink *sink)
+{
+	struct net_buf *buf = (struct net_buf *)ptr;
+
+#ifdef CONFIG_WEAVE_PACKET_ACCOUNTING
+	packet_buf_account(buf, sink, true);
+#else
+	ARG_UNUSED(sink);
+#endif
+
 	struct net_buf *ref = net_buf_ref(buf);
 
 	LOG_DBG("ref: buf=%p, refcount=%d", (void *)buf, buf->ref);
@@ -55,9 +109,23 @@ static void packet_buf_unref(void *ptr)
 	net_buf_unref(buf);
 }
 
+#ifdef CONFIG_WEAVE_PACKET_ACCOUNTING
+static void packet_buf_release(void *ptr, struct weave_sink *sink)
+{
+	/* Count first - the buffer may be freed by the unref */
+	packet_buf_account((struct net_buf *)ptr, sink, false);
+	packet_buf_unref(ptr);
+}
+#endif
+
 const struct weave_payload_ops weave_packet_ops = {
+	.filter = packet_buf_filter,
+	.accepts = packet_id_accepts,
 	.ref = packet_buf_ref,
 	.unref = packet_buf_unref,
+#ifdef CONFIG_WEAVE_PACKET_ACCOUNTING
+	.release = packet_buf_release,
+#endif
 };
 
 /* ============================ Buffer Allocation ============================ */
@@ -65,12 +133,12 @@ const struct weave_payload_ops weave_packet_ops = {
 /**
  * @brief Initialize packet metadata
  */
-static void packet_meta_init(struct weave_packet_metadata *meta, struct weave_packet_pool *pool,
+static void packet_meta_init(struct weave_packet_metadata *meta, atomic_t *counter,
 			     uint8_t packet_id)
 {
 	meta->packet_id = packet_id;
 	meta->client_id = 0;
-	meta->counter = (uint16_t)atomic_inc(&pool->counter);
+	meta->counter = (uint16_t)atomic_inc(counter);
 #ifdef CONFIG_WEAVE_PACKET_TIMESTAMP_HIRES
 	meta->cycles = k_cycle_get_64();
 #else
@@ -83,14 +151,118 @@ struct net_buf *weave_packet_alloc(struct weave_packet_pool *pool, k_timeout_t t
 	return weave_packet_alloc_with_id(pool, WEAVE_PACKET_ID_ANY, timeout);
 }
 
-struct net_buf *weave_packet_alloc_with_id(struct weave_packet_pool *pool, uint8_t packet_id,
-					   k_timeout_t timeout)
+/**
+ * @brief Allocate a buffer of an allocation class from a pool with a reserve
+ *
+ * Normal allocations first take one of the pool's unreserved slots, which
+ * is given back when the buffer is released.
+ */
+static struct net_buf *packet_reserve_alloc(struct weave_packet_pool *pool,
+					    enum weave_packet_prio prio, k_timeout_t timeout)
 {
-	if (!pool || !pool->pool) {
+	struct weave_packet_reserve *reserve = pool->reserve;
+	k_timepoint_t deadline = sys_timepoint_calc(timeout);
+	struct net_buf *buf;
+
+	if (prio == WEAVE_PACKET_PRIO_NORMAL && k_sem_take(&reserve->normal, timeout) != 0) {
+		LOG_DBG("Alloc failed (only reserve left)");
 		return NULL;
 	}
 
-	struct net_buf *buf = net_buf_alloc(pool->pool, timeout);
+	buf = net_buf_alloc(pool->pool, sys_timepoint_timeout(deadline));
+	if (!buf) {
+		if (prio == WEAVE_PACKET_PRIO_NORMAL) {
+			k_sem_give(&reserve->normal);
+		}
+		return NULL;
+	}
+
+	reserve->prio[net_buf_id(buf)] = prio;
+	atomic_inc(&reserve->used[prio]);
+
+	return buf;
+}
+
+/**
+ * @brief Borrow a buffer from the shared reserve of an elastic pool
+ */
+static struct net_buf *packet_borrow(struct weave_packet_borrow *borrow)
+{
+	struct net_buf *buf;
+	atomic_val_t borrowed;
+
+	/* The reserve is usually defined in another file, so this cannot be a
+	 * BUILD_ASSERT. Report the mismatch once; denied counts every borrow.
+	 */
+	if (borrow->reserve->size < borrow->size) {
+		if (!borrow->size_mismatch) {
+			borrow->size_mismatch = true;
+			LOG_ERR("Shared reserve buffers (%zu) smaller than the pool's (%zu)",
+				borrow->reserve->size, borrow->size);
+		}
+		atomic_inc(&borrow->denied);
+		return NULL;
+	}
+
+	do {
+		borrowed = atomic_get(&borrow->borrowed);
+		if (borrowed >= borrow->limit) {
+			atomic_inc(&borrow->denied);
+			return NULL;
+		}
+	} while (!atomic_cas(&borrow->borrowed, borrowed, borrowed + 1));
+
+	buf = net_buf_alloc(borrow->reserve->pool, K_NO_WAIT);
+	if (!buf) {
+		atomic_dec(&borrow->borrowed);
+		atomic_inc(&borrow->denied);
+		return NULL;
+	}
+
+	borrow->reserve->borrowers[net_buf_id(buf)] = borrow;
+	atomic_inc(&borrow->borrows);
+	LOG_DBG("Borrowed buffer (%ld of %u)", (long)borrowed + 1, borrow->limit);
+
+	return buf;
+}
+
+/**
+ * @brief Allocate from an elastic pool
+ *
+ * Own buffers first, then the reserve; only then waits for an own buffer.
+ */
+static struct net_buf *packet_elastic_alloc(struct weave_packet_pool *pool, k_timeout_t timeout)
+{
+	struct net_buf *buf = net_buf_alloc(pool->pool, K_NO_WAIT);
+
+	if (!buf) {
+		buf = packet_borrow(pool->borrow);
+	}
+
+	if (!buf && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		buf = net_buf_alloc(pool->pool, timeout);
+	}
+
+	return buf;
+}
+
+static struct net_buf *packet_alloc(struct weave_packet_pool *pool, uint8_t packet_id,
+				    enum weave_packet_prio prio, k_timeout_t timeout)
+{
+	/* Reference pools have no data - see weave_packet_alloc_ref_data() */
+	if (!pool || !pool->pool || pool->refs) {
+		return NULL;
+	}
+
+	struct net_buf *buf;
+
+	if (pool->reserve) {
+		buf = packet_reserve_alloc(pool, prio, timeout);
+	} else if (pool->borrow) {
+		buf = packet_elastic_alloc(pool, timeout);
+	} else {
+		buf = net_buf_alloc(pool->pool, timeout);
+	}
 
 	if (!buf) {
 		LOG_DBG("Alloc failed (pool exhausted)");
@@ -102,10 +274,194 @@ struct net_buf *weave_packet_alloc_with_id(struct weave_packet_pool *pool, uint8
 	if (buf->user_data_size >= WEAVE_PACKET_METADATA_SIZE) {
 		struct weave_packet_metadata *meta =
 			(struct weave_packet_metadata *)net_buf_user_data(buf);
-		packet_meta_init(meta, pool, packet_id);
+		packet_meta_init(meta, &pool->counter, packet_id);
 		LOG_DBG("Alloc: id=%d, counter=%d", packet_id, meta->counter);
 	} else {
 	}
 
 	return buf;
 }
+
+struct net_buf *weave_packet_alloc_with_id(struct weave_packet_pool *pool, uint8_t packet_id,
+					   k_timeout_t timeout)
+{
+	return packet_alloc(pool, packet_id, WEAVE_PACKET_PRIO_NORMAL, timeout);
+}
+
+struct net_buf *weave_packet_alloc_prio(struct weave_packet_pool *pool, uint8_t packet_id,
+					k_timeout_t timeout)
+{
+	return packet_alloc(pool, packet_id, WEAVE_PACKET_PRIO_HIGH, timeout);
+}
+
+int weave_packet_pool_used(const struct weave_packet_pool *pool, enum weave_packet_prio prio)
+{
+	if (!pool || !pool->reserve || prio >= WEAVE_PACKET_PRIO_COUNT) {
+		return -EINVAL;
+	}
+
+	return (int)atomic_get(&pool->reserve->used[prio]);
+}
+
+void weave_packet_reserve_release(struct weave_packet_pool *pool, struct net_buf *buf)
+{
+	struct weave_packet_reserve *reserve = pool->reserve;
+	uint8_t prio = reserve->prio[net_buf_id(buf)];
+
+	/* Free the buffer before waking a normal allocation waiting for it */
+	net_buf_destroy(buf);
+
+	atomic_dec(&reserve->used[prio]);
+	if (prio == WEAVE_PACKET_PRIO_NORMAL) {
+		k_sem_give(&reserve->normal);
+	}
+}
+
+void weave_packet_shared_release(struct weave_packet_shared_reserve *reserve,
+				 struct net_buf *buf)
+{
+	struct weave_packet_borrow *borrow = reserve->borrowers[net_buf_id(buf)];
+
+	net_buf_destroy(buf);
+	atomic_dec(&borrow->borrowed);
+}
+
+struct net_buf *weave_packet_alloc_size(struct weave_packet_pool_set *set, size_t len,
+					uint8_t packet_id, k_timeout_t timeout)
+{
+	const struct weave_packet_pool_class *fit = NULL;
+	struct net_buf *buf = NULL;
+
+	if (!set) {
+		return NULL;
+	}
+
+	/* Smallest class that fits first, larger ones when it is exhausted */
+	for (size_t i = 0; i < set->num_classes && !buf; i++) {
+		const struct weave_packet_pool_class *cls = &set->classes[i];
+
+		if (cls->size < len) {
+			continue;
+		}
+
+		if (!fit) {
+			fit = cls;
+		}
+		buf = net_buf_alloc(cls->pool, K_NO_WAIT);
+	}
+
+	/* Every class that fits is exhausted - wait for the smallest */
+	if (!buf && fit && !K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		buf = net_buf_alloc(fit->pool, timeout);
+	}
+
+	if (!buf) {
+		LOG_DBG("Alloc of %zu bytes failed (%s)", len, fit ? "set exhausted" : "too large");
+		return NULL;
+	}
+
+	packet_meta_init((struct weave_packet_metadata *)net_buf_user_data(buf), &set->counter,
+			 packet_id);
+
+	return buf;
+}
+
+struct net_buf *weave_packet_alloc_ref_data(struct weave_packet_pool *pool, const void *data,
+					    size_t len, weave_packet_release_t release,
+					    void *user_data, k_timeout_t timeout)
+{
+	if (!pool || !pool->pool || !pool->refs || !data || len > UINT16_MAX) {
+		return NULL;
+	}
+
+	/* Handlers never write to packets, so the const data is not modified */
+	struct net_buf *buf = net_buf_alloc_with_data(pool->pool, (void *)data, len, timeout);
+
+	if (!buf) {
+		LOG_DBG("Ref alloc failed (pool exhausted)");
+		return NULL;
+	}
+
+	pool->refs[net_buf_id(buf)] = (struct weave_packet_ref){
+		.data = data,
+		.release = release,
+		.user_data = user_data,
+	};
+
+	if (buf->user_data_size >= WEAVE_PACKET_METADATA_SIZE) {
+		packet_meta_init((struct weave_packet_metadata *)net_buf_user_data(buf),
+				 &pool->counter, WEAVE_PACKET_ID_ANY);
+	}
+
+	return buf;
+}
+
+void weave_packet_ref_release(struct weave_packet_pool *pool, struct net_buf *buf)
+{
+	/* net_buf_unref() has already cleared the data pointers */
+	struct weave_packet_ref ref = pool->refs[net_buf_id(buf)];
+
+	/* Free the buffer first, so release can allocate the next packet */
+	net_buf_destroy(buf);
+
+	if (ref.release) {
+		ref.release(ref.data, ref.user_data);
+	}
+}
+
+/* ============================ Lazy Send ============================ */
+
+struct packet_lazy_ctx {
+	struct weave_packet_pool *pool;
+	uint8_t packet_id;
+	weave_packet_fill_t fill;
+	void *user_data;
+	k_timeout_t timeout;
+};
+
+/**
+ * @brief Producer for weave_packet_send_lazy() - allocate and fill
+ */
+static int packet_lazy_produce(void **ptr, void *user_data)
+{
+	struct packet_lazy_ctx *ctx = (struct packet_lazy_ctx *)user_data;
+	struct net_buf *buf = weave_packet_alloc_with_id(ctx->pool, ctx->packet_id, ctx->timeout);
+
+	if (!buf) {
+		return -ENOMEM;
+	}
+
+	int ret = ctx->fill(buf, ctx->user_data);
+
+	if (ret < 0) {
+		net_buf_unref(buf);
+		return ret;
+	}
+
+	*ptr = buf;
+	return 0;
+}
+
+bool weave_packet_would_deliver(struct weave_source *source, uint8_t packet_id)
+{
+	return weave_source_would_deliver(source, &packet_id);
+}
+
+int weave_packet_send_lazy(struct weave_source *source, struct weave_packet_pool *pool,
+			   uint8_t packet_id, weave_packet_fill_t fill, void *user_data,
+			   k_timeout_t timeout)
+{
+	if (!pool || !fill) {
+		return -EINVAL;
+	}
+
+	struct packet_lazy_ctx ctx = {
+		.pool = pool,
+		.packet_id = packet_id,
+		.fill = fill,
+		.user_data = user_data,
+		.timeout = timeout,
+	};
+
+	return weave_source_emit_lazy(source, &packet_id, packet_lazy_produce, &ctx, timeout);
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Packet Accounting - references held per pool and holder
+ */
+
+#include <weave/packet_account.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/spinlock.h>
+
+LOG_MODULE_REGISTER(weave_packet_account, CONFIG_WEAVE_LOG_LEVEL);
+
+/* One slot per pool and holder with references; a slot is free when refs is 0 */
+static struct weave_packet_holding slots[CONFIG_WEAVE_PACKET_ACCOUNTING_SLOTS];
+static struct k_spinlock lock;
+static uint32_t missed;
+
+/* ============================ Accounting ============================ */
+
+void weave_packet_account(const struct net_buf *buf, const void *holder,
+			  enum weave_packet_holder_kind kind, bool hold)
+{
+	const struct net_buf_pool *pool = net_buf_pool_get(buf->pool_id);
+	struct weave_packet_holding *free_slot = NULL;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (size_t i = 0; i < ARRAY_SIZE(slots); i++) {
+		struct weave_packet_holding *slot = &slots[i];
+
+		if (slot->refs == 0) {
+			free_slot = free_slot ? free_slot : slot;
+			continue;
+		}
+
+		if (slot->pool == pool && slot->holder == holder) {
+			if (hold) {
+				slot->refs++;
+			} else {
+				slot->refs--;
+			}
+			k_spin_unlock(&lock, key);
+			return;
+		}
+	}
+
+	/* Releases without a slot were not counted when taken */
+	if (hold && free_slot) {
+		*free_slot = (struct weave_packet_holding){
+			.pool = pool,
+			.holder = holder,
+			.kind = kind,
+			.refs = 1,
+		};
+	} else if (hold) {
+		missed++;
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+struct net_buf *weave_packet_hold(struct net_buf *buf, const struct weave_packet_holder *holder)
+{
+	weave_packet_account(buf, holder, WEAVE_PACKET_HOLDER_USER, true);
+
+	return net_buf_ref(buf);
+}
+
+void weave_packet_unhold(struct net_buf *buf, const struct weave_packet_holder *holder)
+{
+	/* Count first - the buffer may be freed by the unref */
+	weave_packet_account(buf, holder, WEAVE_PACKET_HOLDER_USER, false);
+	net_buf_unref(buf);
+}
+
+/* ============================ Reporting ============================ */
+
+size_t weave_packet_holdings(struct weave_packet_holding *holdings, size_t max)
+{
+	size_t count = 0;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (size_t i = 0; i < ARRAY_SIZE(slots) && count < max; i++) {
+		if (slots[i].refs > 0) {
+			holdings[count++] = slots[i];
+		}
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return count;
+}
+
+uint32_t weave_packet_holdings_missed(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+	uint32_t count = missed;
+
+	k_spin_unlock(&lock, key);
+
+	return count;
+}
+
+void weave_packet_holdings_dump(void)
+{
+	static const char *const kinds[] = {
+		[WEAVE_PACKET_HOLDER_QUEUE] = "queue",
+		[WEAVE_PACKET_HOLDER_HANDLER] = "handler",
+		[WEAVE_PACKET_HOLDER_USER] = "user",
+	};
+
+	LOG_INF("Packet references held (%u not counted):", weave_packet_holdings_missed());
+
+	/* One slot at a time, so nothing is logged under the lock */
+	for (size_t i = 0; i < ARRAY_SIZE(slots); i++) {
+		k_spinlock_key_t key = k_spin_lock(&lock);
+		struct weave_packet_holding holding = slots[i];
+
+		k_spin_unlock(&lock, key);
+
+		if (holding.refs == 0) {
+			continue;
+		}
+
+		if (holding.kind == WEAVE_PACKET_HOLDER_USER) {
+			const struct weave_packet_holder *holder = holding.holder;
+
+			LOG_INF("  pool %p: %u refs by %s %s", (void *)holding.pool, holding.refs,
+				kinds[holding.kind], holder->name);
+		} else {
+			LOG_INF("  pool %p: %u refs by %s %p", (void *)holding.pool, holding.refs,
+				kinds[holding.kind], holding.holder);
+		}
+	}
+}
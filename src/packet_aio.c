@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Packet AIO - asynchronous transport writes
+ */
+
+#include <weave/packet_aio.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(weave_packet_aio, CONFIG_WEAVE_LOG_LEVEL);
+
+/* ============================ Internal Helpers ============================ */
+
+/**
+ * @brief Start waiting packets while the backend has free slots
+ *
+ * Only one context runs the loop at a time. A completion reported while
+ * it runs - including one reported from inside the submit function - only
+ * frees the slot, and the loop starts the next packet once the backend
+ * has returned, so completions never re-enter submit.
+ */
+static void aio_start(struct weave_packet_aio *aio)
+{
+	k_spinlock_key_t key = k_spin_lock(&aio->lock);
+
+	if (aio->starting) {
+		k_spin_unlock(&aio->lock, key);
+		return;
+	}
+	aio->starting = true;
+
+	while (aio->waiting > 0 && aio->in_flight < aio->max_in_flight) {
+		struct net_buf *buf = aio->ring[aio->head];
+
+		aio->head = (aio->head + 1) % aio->ring_size;
+		aio->waiting--;
+		aio->in_flight++;
+		k_spin_unlock(&aio->lock, key);
+
+		int ret = aio->submit(aio, buf);
+
+		if (ret < 0) {
+			/* Could not start - complete with error and move on */
+			LOG_DBG("Submit failed: %d", ret);
+			net_buf_unref(buf);
+		}
+
+		key = k_spin_lock(&aio->lock);
+		if (ret < 0) {
+			aio->in_flight--;
+			aio->completed++;
+			aio->errors++;
+		}
+	}
+
+	aio->starting = false;
+	k_spin_unlock(&aio->lock, key);
+}
+
+/* ============================ AIO Functions ============================ */
+
+int weave_packet_aio_write(struct weave_packet_aio *aio, struct net_buf *buf)
+{
+	if (!aio || !aio->submit || !buf) {
+		if (buf) {
+			net_buf_unref(buf);
+		}
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&aio->lock);
+
+	if (aio->waiting == aio->ring_size) {
+		aio->dropped++;
+		k_spin_unlock(&aio->lock, key);
+		LOG_DBG("AIO ring full, dropped packet");
+		net_buf_unref(buf);
+		return -ENOBUFS;
+	}
+
+	aio->ring[(aio->head + aio->waiting) % aio->ring_size] = buf;
+	aio->waiting++;
+	k_spin_unlock(&aio->lock, key);
+
+	aio_start(aio);
+
+	return 0;
+}
+
+void weave_packet_aio_complete(struct weave_packet_aio *aio, struct net_buf *buf, int result)
+{
+	if (!aio || !buf) {
+		return;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&aio->lock);
+
+	aio->in_flight--;
+	aio->completed++;
+	if (result < 0) {
+		aio->errors++;
+	}
+	k_spin_unlock(&aio->lock, key);
+
+	net_buf_unref(buf);
+
+	aio_start(aio);
+}
+
+void weave_packet_aio_handler(struct net_buf *buf, void *user_data)
+{
+	/* Keep the packet alive past the handler until the write completes */
+	weave_packet_aio_write(user_data, net_buf_ref(buf));
+}
+
+/* ============================ UART Backend ============================ */
+
+#ifdef CONFIG_WEAVE_PACKET_AIO_UART
+/**
+ * @brief Send the next non-empty fragment from frag on
+ *
+ * @return 0 if a fragment was started, 1 if none is left, negative errno
+ */
+static int aio_uart_send(struct weave_packet_aio_uart *uart, struct net_buf *frag)
+{
+	while (frag && frag->len == 0) {
+		frag = frag->frags;
+	}
+
+	uart->frag = frag;
+	if (!frag) {
+		return 1;
+	}
+
+	return uart_tx(uart->dev, frag->data, frag->len, SYS_FOREVER_US);
+}
+
+bool weave_packet_aio_uart_event(struct weave_packet_aio *aio, const struct uart_event *evt)
+{
+	struct weave_packet_aio_uart *uart = aio->backend;
+	struct net_buf *buf = uart->buf;
+	int ret;
+
+	switch (evt->type) {
+	case UART_TX_DONE:
+		ret = aio_uart_send(uart, uart->frag->frags);
+		if (ret == 0) {
+			return true;
+		}
+		uart->buf = NULL;
+		weave_packet_aio_complete(aio, buf, ret > 0 ? 0 : ret);
+		return true;
+	case UART_TX_ABORTED:
+		uart->buf = NULL;
+		weave_packet_aio_complete(aio, buf, -EIO);
+		return true;
+	default:
+		return false;
+	}
+}
+
+static void aio_uart_callback(const struct device *dev, struct uart_event *evt, void *user_data)
+{
+	ARG_UNUSED(dev);
+
+	weave_packet_aio_uart_event(user_data, evt);
+}
+
+int weave_packet_aio_uart_init(struct weave_packet_aio *aio)
+{
+	if (!aio || !aio->backend) {
+		return -EINVAL;
+	}
+
+	struct weave_packet_aio_uart *uart = aio->backend;
+
+	if (!device_is_ready(uart->dev)) {
+		return -ENODEV;
+	}
+
+	return uart_callback_set(uart->dev, aio_uart_callback, aio);
+}
+
+int weave_packet_aio_uart_submit(struct weave_packet_aio *aio, struct net_buf *buf)
+{
+	struct weave_packet_aio_uart *uart = aio->backend;
+
+	uart->buf = buf;
+
+	int ret = aio_uart_send(uart, buf);
+
+	if (ret > 0) {
+		/* Empty packet - nothing to send, the channel starts the next one after return */
+		uart->buf = NULL;
+		weave_packet_aio_complete(aio, buf, 0);
+		return 0;
+	}
+
+	if (ret < 0) {
+		uart->buf = NULL;
+	}
+
+	return ret;
+}
+#endif /* CONFIG_WEAVE_PACKET_AIO_UART */
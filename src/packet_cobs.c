@@ -0,0 +1,319 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Packet COBS - frame encoding and streaming decoding
+ */
+
+#include <weave/packet_cobs.h>
+#include <zephyr/logging/log.h>
+#include <string.h>
+
+LOG_MODULE_REGISTER(weave_packet_cobs, CONFIG_WEAVE_LOG_LEVEL);
+
+/* Largest code byte - a block of 254 data bytes without implied zero */
+#define COBS_BLOCK_MAX 0xFF
+
+/* ============================ Encoder ============================ */
+
+struct cobs_writer {
+	struct weave_packet_pool *pool;
+	k_timeout_t timeout;
+	struct net_buf *head;
+	struct net_buf *tail;
+};
+
+/**
+ * @brief Make sure the last frame fragment has room for at least one byte
+ */
+static int cobs_grow(struct cobs_writer *w)
+{
+	if (w->tail && net_buf_tailroom(w->tail) > 0) {
+		return 0;
+	}
+
+	struct net_buf *frag = w->tail ? net_buf_alloc(w->pool->pool, w->timeout)
+				       : weave_packet_alloc(w->pool, w->timeout);
+
+	if (!frag) {
+		return -ENOMEM;
+	}
+
+	if (w->tail) {
+		net_buf_frag_insert(w->tail, frag);
+	} else {
+		w->head = frag;
+	}
+	w->tail = frag;
+
+	return 0;
+}
+
+/**
+ * @brief Reserve the code byte of the next block
+ */
+static uint8_t *cobs_code_reserve(struct cobs_writer *w)
+{
+	if (cobs_grow(w) < 0) {
+		return NULL;
+	}
+
+	return net_buf_add(w->tail, 1);
+}
+
+struct net_buf *weave_packet_cobs_encode(const struct net_buf *buf,
+					 struct weave_packet_pool *pool, k_timeout_t timeout)
+{
+	if (!buf || !pool || !pool->pool) {
+		return NULL;
+	}
+
+	struct cobs_writer w = {.pool = pool, .timeout = timeout};
+	uint8_t *code_ptr = cobs_code_reserve(&w);
+	uint8_t code = 1;
+
+	if (!code_ptr) {
+		goto fail;
+	}
+
+	for (const struct net_buf *frag = buf; frag; frag = frag->frags) {
+		const uint8_t *data = frag->data;
+		size_t left = frag->len;
+
+		while (left > 0) {
+			if (*data != 0) {
+				/* Copy a run of non-zero bytes, bounded by block and fragment */
+				if (cobs_grow(&w) < 0) {
+					goto fail;
+				}
+
+				size_t run = MIN(MIN(left, net_buf_tailroom(w.tail)),
+						 (size_t)(COBS_BLOCK_MAX - code));
+				const uint8_t *zero = memchr(data, 0, run);
+
+				if (zero) {
+					run = zero - data;
+				}
+
+				net_buf_add_mem(w.tail, data, run);
+				data += run;
+				left -= run;
+				code += run;
+
+				if (code < COBS_BLOCK_MAX) {
+					continue;
+				}
+			} else {
+				/* The zero is implied by the code byte */
+				data++;
+				left--;
+			}
+
+			/* Close the block */
+			*code_ptr = code;
+			code_ptr = cobs_code_reserve(&w);
+			if (!code_ptr) {
+				goto fail;
+			}
+			code = 1;
+		}
+	}
+
+	*code_ptr = code;
+
+	if (cobs_grow(&w) < 0) {
+		goto fail;
+	}
+	net_buf_add_u8(w.tail, WEAVE_PACKET_COBS_DELIMITER);
+
+	return w.head;
+
+fail:
+	LOG_DBG("Encode failed (pool exhausted)");
+	if (w.head) {
+		net_buf_unref(w.head);
+	}
+	return NULL;
+}
+
+/* ============================ Decoder ============================ */
+
+/**
+ * @brief Drop the packet being decoded and wait for the next frame
+ */
+static void cobs_drop(struct weave_packet_cobs_decoder *dec)
+{
+	if (dec->buf) {
+		net_buf_unref(dec->buf);
+		dec->buf = NULL;
+		dec->tail = NULL;
+	}
+
+	dec->code = 0;
+	dec->remaining = 0;
+}
+
+/**
+ * @brief Append decoded bytes, chaining pool fragments as needed
+ *
+ * This is the one copy of each received byte. Slices of the caller's
+ * buffer would avoid it, but would keep that buffer (a UART RX buffer)
+ * held for as long as the application holds the packet.
+ */
+static int cobs_append(struct weave_packet_cobs_decoder *dec, const uint8_t *data, size_t len)
+{
+	while (len > 0) {
+		if (net_buf_tailroom(dec->tail) == 0) {
+			struct net_buf *frag = net_buf_alloc(dec->pool->pool, K_NO_WAIT);
+
+			if (!frag) {
+				return -ENOMEM;
+			}
+
+			net_buf_frag_insert(dec->tail, frag);
+			dec->tail = frag;
+		}
+
+		size_t n = MIN(len, net_buf_tailroom(dec->tail));
+
+		net_buf_add_mem(dec->tail, data, n);
+		data += n;
+		len -= n;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Start a block on a code byte
+ */
+static int cobs_block_start(struct weave_packet_cobs_decoder *dec, uint8_t code)
+{
+	static const uint8_t zero;
+
+	if (!dec->buf) {
+		dec->buf = weave_packet_alloc(dec->pool, K_NO_WAIT);
+		if (!dec->buf) {
+			return -ENOMEM;
+		}
+		dec->tail = dec->buf;
+	} else if (dec->code != COBS_BLOCK_MAX) {
+		/* A block shorter than the maximum ends in an implied zero */
+		int ret = cobs_append(dec, &zero, 1);
+
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	dec->code = code;
+	dec->remaining = code - 1;
+
+	return 0;
+}
+
+/**
+ * @brief Send the packet completed by a delimiter
+ *
+ * @return 1 if a packet was sent, 0 for an empty frame
+ */
+static int cobs_finish(struct weave_packet_cobs_decoder *dec)
+{
+	struct net_buf *buf = dec->buf;
+
+	if (!buf) {
+		/* Back-to-back delimiters - nothing to send */
+		return 0;
+	}
+
+	dec->buf = NULL;
+	dec->tail = NULL;
+	dec->code = 0;
+	dec->frames++;
+
+	weave_packet_send(dec->source, buf, K_NO_WAIT);
+
+	return 1;
+}
+
+int weave_packet_cobs_decode(struct weave_packet_cobs_decoder *dec, const uint8_t *data,
+			     size_t len)
+{
+	if (!dec || !dec->pool || !dec->source || (!data && len > 0)) {
+		return -EINVAL;
+	}
+
+	int frames = 0;
+
+	while (len > 0) {
+		if (dec->discard) {
+			const uint8_t *end = memchr(data, WEAVE_PACKET_COBS_DELIMITER, len);
+
+			if (!end) {
+				break;
+			}
+
+			len -= end - data + 1;
+			data = end + 1;
+			dec->discard = false;
+			continue;
+		}
+
+		if (dec->remaining == 0) {
+			uint8_t byte = *data++;
+
+			len--;
+
+			if (byte == WEAVE_PACKET_COBS_DELIMITER) {
+				frames += cobs_finish(dec);
+			} else if (cobs_block_start(dec, byte) < 0) {
+				LOG_DBG("Decode dropped frame (pool exhausted)");
+				cobs_drop(dec);
+				dec->errors++;
+				dec->discard = true;
+			}
+			continue;
+		}
+
+		size_t run = MIN(len, dec->remaining);
+		const uint8_t *zero = memchr(data, WEAVE_PACKET_COBS_DELIMITER, run);
+
+		if (zero) {
+			/* Delimiter inside a block - frame was truncated */
+			LOG_DBG("Decode dropped truncated frame");
+			cobs_drop(dec);
+			dec->errors++;
+			len -= zero - data + 1;
+			data = zero + 1;
+			continue;
+		}
+
+		if (cobs_append(dec, data, run) < 0) {
+			LOG_DBG("Decode dropped frame (pool exhausted)");
+			cobs_drop(dec);
+			dec->errors++;
+			dec->discard = true;
+			continue;
+		}
+
+		data += run;
+		len -= run;
+		dec->remaining -= run;
+	}
+
+	return frames;
+}
+
+void weave_packet_cobs_decoder_reset(struct weave_packet_cobs_decoder *dec)
+{
+	if (!dec) {
+		return;
+	}
+
+	cobs_drop(dec);
+	dec->discard = true;
+}
@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Packet Cursor - zero-copy access to fragmented packets
+ */
+
+#include <weave/packet_cursor.h>
+#include <zephyr/sys/byteorder.h>
+#include <errno.h>
+#include <string.h>
+
+/* ============================ Cursor Movement ============================ */
+
+/* Keep the cursor off the end of a fragment and off empty fragments */
+static void cursor_normalize(struct weave_packet_cursor *cursor)
+{
+	while (cursor->frag && cursor->offset == cursor->frag->len) {
+		cursor->frag = cursor->frag->frags;
+		cursor->offset = 0;
+	}
+}
+
+static inline void cursor_advance(struct weave_packet_cursor *cursor, size_t len)
+{
+	cursor->offset += len;
+	cursor_normalize(cursor);
+}
+
+static bool cursor_has(const struct weave_packet_cursor *cursor, size_t len)
+{
+	size_t avail = weave_packet_cursor_contiguous(cursor);
+
+	for (struct net_buf *frag = cursor->frag; avail < len && frag;) {
+		frag = frag->frags;
+		avail += frag ? frag->len : 0;
+	}
+
+	return avail >= len;
+}
+
+/* Copy len bytes out of the packet; the caller has checked they remain */
+static void cursor_copy_out(struct weave_packet_cursor *cursor, uint8_t *dst, size_t len)
+{
+	while (len > 0) {
+		size_t n = MIN(len, weave_packet_cursor_contiguous(cursor));
+
+		memcpy(dst, cursor->frag->data + cursor->offset, n);
+		dst += n;
+		len -= n;
+		cursor_advance(cursor, n);
+	}
+}
+
+/* Copy len bytes into the packet; the caller has checked they remain */
+static void cursor_copy_in(struct weave_packet_cursor *cursor, const uint8_t *src, size_t len)
+{
+	while (len > 0) {
+		size_t n = MIN(len, weave_packet_cursor_contiguous(cursor));
+
+		memcpy(cursor->frag->data + cursor->offset, src, n);
+		src += n;
+		len -= n;
+		cursor_advance(cursor, n);
+	}
+}
+
+/* ============================ Cursor Functions ============================ */
+
+void weave_packet_cursor_init(struct weave_packet_cursor *cursor, struct net_buf *buf)
+{
+	cursor->frag = buf;
+	cursor->offset = 0;
+	cursor_normalize(cursor);
+}
+
+size_t weave_packet_cursor_remaining(const struct weave_packet_cursor *cursor)
+{
+	size_t len = weave_packet_cursor_contiguous(cursor);
+
+	for (struct net_buf *frag = cursor->frag ? cursor->frag->frags : NULL; frag;
+	     frag = frag->frags) {
+		len += frag->len;
+	}
+
+	return len;
+}
+
+int weave_packet_cursor_skip(struct weave_packet_cursor *cursor, size_t len)
+{
+	if (!cursor_has(cursor, len)) {
+		return -ENODATA;
+	}
+
+	while (len > 0) {
+		size_t n = MIN(len, weave_packet_cursor_contiguous(cursor));
+
+		len -= n;
+		cursor_advance(cursor, n);
+	}
+
+	return 0;
+}
+
+int weave_packet_cursor_peek(const struct weave_packet_cursor *cursor, void *dst, size_t len)
+{
+	struct weave_packet_cursor tmp = *cursor;
+
+	return weave_packet_cursor_read(&tmp, dst, len);
+}
+
+int weave_packet_cursor_read(struct weave_packet_cursor *cursor, void *dst, size_t len)
+{
+	if (!cursor_has(cursor, len)) {
+		return -ENODATA;
+	}
+
+	cursor_copy_out(cursor, dst, len);
+
+	return 0;
+}
+
+int weave_packet_cursor_write(struct weave_packet_cursor *cursor, const void *src, size_t len)
+{
+	if (!cursor_has(cursor, len)) {
+		return -ENODATA;
+	}
+
+	cursor_copy_in(cursor, src, len);
+
+	return 0;
+}
+
+/* ============================ Fixed-width Accessors ============================ */
+
+static inline uint8_t cursor_get_u8(const uint8_t *src)
+{
+	return *src;
+}
+
+static inline void cursor_put_u8(uint8_t val, uint8_t *dst)
+{
+	*dst = val;
+}
+
+/* In place when the value is inside one fragment, assembled otherwise */
+#define CURSOR_ACCESSORS(_name, _type, _get, _put)                                                 \
+	int weave_packet_cursor_read_##_name(struct weave_packet_cursor *cursor, _type *val)      \
+	{                                                                                          \
+		const uint8_t *src = weave_packet_cursor_view(cursor, sizeof(_type));             \
+		uint8_t tmp[sizeof(_type)];                                                        \
+                                                                                                   \
+		if (src) {                                                                         \
+			*val = _get(src);                                                          \
+			cursor_advance(cursor, sizeof(_type));                                     \
+			return 0;                                                                  \
+		}                                                                                  \
+                                                                                                   \
+		if (weave_packet_cursor_read(cursor, tmp, sizeof(tmp)) < 0) {                      \
+			return -ENODATA;                                                           \
+		}                                                                                  \
+		*val = _get(tmp);                                                                  \
+		return 0;                                                                          \
+	}                                                                                          \
+                                                                                                   \
+	int weave_packet_cursor_write_##_name(struct weave_packet_cursor *cursor, _type val)      \
+	{                                                                                          \
+		uint8_t *dst = weave_packet_cursor_view(cursor, sizeof(_type));                   \
+		uint8_t tmp[sizeof(_type)];                                                        \
+                                                                                                   \
+		if (dst) {                                                                         \
+			_put(val, dst);                                                            \
+			cursor_advance(cursor, sizeof(_type));                                     \
+			return 0;                                                                  \
+		}                                                                                  \
+                                                                                                   \
+		_put(val, tmp);                                                                    \
+		return weave_packet_cursor_write(cursor, tmp, sizeof(tmp));                        \
+	}
+
+CURSOR_ACCESSORS(u8, uint8_t, cursor_get_u8, cursor_put_u8)
+CURSOR_ACCESSORS(le16, uint16_t, sys_get_le16, sys_put_le16)
+CURSOR_ACCESSORS(be16, uint16_t, sys_get_be16, sys_put_be16)
+CURSOR_ACCESSORS(le32, uint32_t, sys_get_le32, sys_put_le32)
+CURSOR_ACCESSORS(be32, uint32_t, sys_get_be32, sys_put_be32)
+CURSOR_ACCESSORS(le64, uint64_t, sys_get_le64, sys_put_le64)
+CURSOR_ACCESSORS(be64, uint64_t, sys_get_be64, sys_put_be64)
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Packet Merge - time-ordered k-way merge of packet streams
+ */
+
+#include <weave/packet_merge.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(weave_packet_merge, CONFIG_WEAVE_LOG_LEVEL);
+
+/* ============================ Time ============================ */
+
+/* Timestamps wrap, so they are compared by signed difference */
+#ifdef CONFIG_WEAVE_PACKET_TIMESTAMP_HIRES
+typedef int64_t merge_delta_t;
+#define MERGE_NOW()       k_cycle_get_64()
+#define MERGE_US(_us)     k_us_to_cyc_ceil64(_us)
+#define MERGE_TIMEOUT(_t) K_CYC(_t)
+#else
+typedef int32_t merge_delta_t;
+#define MERGE_NOW()       ((uint32_t)k_uptime_ticks())
+#define MERGE_US(_us)     k_us_to_ticks_ceil32(_us)
+#define MERGE_TIMEOUT(_t) K_TICKS(_t)
+#endif
+
+static inline weave_packet_merge_time_t merge_stamp(struct net_buf *buf)
+{
+	struct weave_packet_metadata *meta = weave_packet_get_meta(buf);
+
+#ifdef CONFIG_WEAVE_PACKET_TIMESTAMP_HIRES
+	return meta->cycles;
+#else
+	return meta->ticks;
+#endif
+}
+
+static inline bool merge_before(weave_packet_merge_time_t a, weave_packet_merge_time_t b)
+{
+	return (merge_delta_t)(a - b) < 0;
+}
+
+/* ============================ Heap ============================ */
+
+/* Equal timestamps go to the lower input, so ties keep a stable order */
+static inline bool entry_before(const struct weave_packet_merge_entry *a,
+				const struct weave_packet_merge_entry *b)
+{
+	return merge_before(a->stamp, b->stamp) || (a->stamp == b->stamp && a->input < b->input);
+}
+
+static void heap_sift_up(struct weave_packet_merge *merge, size_t pos)
+{
+	struct weave_packet_merge_entry entry = merge->heap[pos];
+
+	while (pos > 0) {
+		size_t parent = (pos - 1) / 2;
+
+		if (!entry_before(&entry, &merge->heap[parent])) {
+			break;
+		}
+		merge->heap[pos] = merge->heap[parent];
+		pos = parent;
+	}
+
+	merge->heap[pos] = entry;
+}
+
+static void heap_sift_down(struct weave_packet_merge *merge, size_t pos)
+{
+	struct weave_packet_merge_entry entry = merge->heap[pos];
+
+	for (;;) {
+		size_t child = 2 * pos + 1;
+
+		if (child >= merge->heap_len) {
+			break;
+		}
+		if (child + 1 < merge->heap_len &&
+		    entry_before(&merge->heap[child + 1], &merge->heap[child])) {
+			child++;
+		}
+		if (!entry_before(&merge->heap[child], &entry)) {
+			break;
+		}
+		merge->heap[pos] = merge->heap[child];
+		pos = child;
+	}
+
+	merge->heap[pos] = entry;
+}
+
+/* ============================ Merge ============================ */
+
+/**
+ * @brief Send the oldest buffered packet (lock held)
+ */
+static void merge_send_oldest(struct weave_packet_merge *merge)
+{
+	struct weave_packet_merge_entry *root = &merge->heap[0];
+	struct weave_packet_merge_input *input = &merge->inputs[root->input];
+	struct net_buf *buf = input->ring[input->head];
+
+	input->head = (input->head + 1) % merge->depth;
+	input->count--;
+
+	merge->last = root->stamp;
+	merge->started = true;
+
+	/* The input's next packet takes its place, or the last entry if it ran empty */
+	if (input->count > 0) {
+		root->stamp = merge_stamp(input->ring[input->head]);
+	} else {
+		*root = merge->heap[--merge->heap_len];
+	}
+
+	if (merge->heap_len > 0) {
+		heap_sift_down(merge, 0);
+	}
+
+	merge->merged++;
+	weave_packet_send(&merge->source, buf, K_NO_WAIT);
+}
+
+/**
+ * @brief Send the packets that are due and rearm the lateness flush (lock held)
+ *
+ * The oldest packet is due when every input has a packet buffered, as
+ * nothing older can arrive, or when it is older than the lateness bound.
+ */
+static void merge_drain(struct weave_packet_merge *merge)
+{
+	weave_packet_merge_time_t horizon = MERGE_NOW() - MERGE_US(merge->lateness_us);
+
+	while (merge->heap_len > 0 && (merge->heap_len == merge->num_inputs ||
+				       !merge_before(horizon, merge->heap[0].stamp))) {
+		merge_send_oldest(merge);
+	}
+
+	if (merge->heap_len > 0) {
+		k_work_reschedule(&merge->flush, MERGE_TIMEOUT(merge->heap[0].stamp - horizon));
+	}
+}
+
+void weave_packet_merge_handler(struct net_buf *buf, void *user_data)
+{
+	struct weave_packet_merge_input *input = user_data;
+	struct weave_packet_merge *merge = input->merge;
+	weave_packet_merge_time_t stamp = merge_stamp(buf);
+
+	k_mutex_lock(&merge->lock, K_FOREVER);
+
+	if ((merge->started && merge_before(stamp, merge->last)) ||
+	    (input->count > 0 && merge_before(stamp, input->newest))) {
+		LOG_DBG("Late packet on input %u", input->index);
+		merge->late++;
+		k_mutex_unlock(&merge->lock);
+		return;
+	}
+
+	/* Make room - everything sent before this input's oldest packet is older still */
+	while (input->count == merge->depth) {
+		merge_send_oldest(merge);
+		merge->forced++;
+	}
+
+	input->ring[(input->head + input->count) % merge->depth] = net_buf_ref(buf);
+	input->newest = stamp;
+
+	if (input->count++ == 0) {
+		merge->heap[merge->heap_len++] = (struct weave_packet_merge_entry){
+			.stamp = stamp,
+			.input = input->index,
+		};
+		heap_sift_up(merge, merge->heap_len - 1);
+	}
+
+	merge_drain(merge);
+
+	k_mutex_unlock(&merge->lock);
+}
+
+void weave_packet_merge_flush_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct weave_packet_merge *merge = CONTAINER_OF(dwork, struct weave_packet_merge, flush);
+
+	k_mutex_lock(&merge->lock, K_FOREVER);
+	merge_drain(merge);
+	k_mutex_unlock(&merge->lock);
+}
+
+int weave_packet_merge_flush(struct weave_packet_merge *merge)
+{
+	int sent = 0;
+
+	if (!merge) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&merge->lock, K_FOREVER);
+
+	while (merge->heap_len > 0) {
+		merge_send_oldest(merge);
+		sent++;
+	}
+
+	k_mutex_unlock(&merge->lock);
+
+	return sent;
+}
+
+int weave_packet_merge_pending(struct weave_packet_merge *merge)
+{
+	int pending = 0;
+
+	if (!merge) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&merge->lock, K_FOREVER);
+
+	for (size_t i = 0; i < merge->num_inputs; i++) {
+		pending += merge->inputs[i].count;
+	}
+
+	k_mutex_unlock(&merge->lock);
+
+	return pending;
+}
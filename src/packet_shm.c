@@ -0,0 +1,317 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Packet SHM - shared memory ring transport
+ */
+
+#include <weave/packet_shm.h>
+#include <zephyr/logging/log.h>
+
+#include "packet_shm_adapt.h"
+
+LOG_MODULE_REGISTER(weave_packet_shm, CONFIG_WEAVE_LOG_LEVEL);
+
+/* Written by side 0 once both rings are set up */
+#define SHM_MAGIC 0x57565348
+
+/* Records start on this boundary */
+#define SHM_RECORD_ALIGN 8
+
+/* Record flags */
+#define SHM_RECORD_PAD      BIT(0) /* Filler up to the end of the ring */
+#define SHM_RECORD_RELEASED BIT(1) /* All slices of the record released */
+
+/* Start of the shared memory object */
+struct shm_header {
+	atomic_t magic;
+	uint32_t ring_size;
+};
+
+/* Record header, followed by the payload */
+struct shm_record {
+	uint16_t len;
+	uint8_t flags;
+	uint8_t packet_id;
+	uint8_t client_id;
+	uint8_t reserved;
+	uint16_t counter;
+};
+
+BUILD_ASSERT(sizeof(struct shm_record) == SHM_RECORD_ALIGN);
+
+/* ============================ Internal Helpers ============================ */
+
+static size_t shm_ring_bytes(uint32_t ring_size)
+{
+	return ROUND_UP(sizeof(struct weave_packet_shm_ring) + ring_size, SHM_RECORD_ALIGN);
+}
+
+static size_t shm_region_bytes(uint32_t ring_size)
+{
+	size_t header = ROUND_UP(sizeof(struct shm_header), SHM_RECORD_ALIGN);
+
+	return header + 2 * shm_ring_bytes(ring_size);
+}
+
+static struct weave_packet_shm_ring *shm_ring(void *region, uint32_t ring_size, int index)
+{
+	uint8_t *rings = (uint8_t *)region + ROUND_UP(sizeof(struct shm_header), SHM_RECORD_ALIGN);
+
+	return (struct weave_packet_shm_ring *)(rings + index * shm_ring_bytes(ring_size));
+}
+
+static struct shm_record *shm_record_at(struct weave_packet_shm_ring *ring, uint32_t pos)
+{
+	return (struct shm_record *)&ring->data[pos & (ring->size - 1)];
+}
+
+static uint32_t shm_record_bytes(const struct shm_record *rec)
+{
+	return ROUND_UP(sizeof(*rec) + rec->len, SHM_RECORD_ALIGN);
+}
+
+/**
+ * @brief Move the RX tail past released records
+ *
+ * Slices may be released in any order; space is returned to the writer
+ * in ring order. Call with rx_lock held.
+ */
+static void shm_rx_reclaim(struct weave_packet_shm *shm)
+{
+	struct weave_packet_shm_ring *rx = shm->rx;
+	uint32_t tail = atomic_get(&rx->tail);
+
+	while (tail != shm->read) {
+		struct shm_record *rec = shm_record_at(rx, tail);
+
+		if (rec->flags & SHM_RECORD_PAD) {
+			tail += rx->size - (tail & (rx->size - 1));
+		} else if (rec->flags & SHM_RECORD_RELEASED) {
+			tail += shm_record_bytes(rec);
+		} else {
+			break;
+		}
+	}
+
+	atomic_set(&rx->tail, tail);
+}
+
+/**
+ * @brief Send every record written since the last call as a slice
+ *
+ * @return Packets sent, or -ENOBUFS if records wait for a free slice
+ */
+static int shm_rx_drain(struct weave_packet_shm *shm)
+{
+	struct weave_packet_shm_ring *rx = shm->rx;
+	uint32_t head = atomic_get(&rx->head);
+	int count = 0;
+
+	while (shm->read != head) {
+		struct shm_record *rec = shm_record_at(rx, shm->read);
+		struct net_buf *buf = NULL;
+		uint32_t next;
+
+		if (rec->flags & SHM_RECORD_PAD) {
+			next = shm->read + rx->size - (shm->read & (rx->size - 1));
+		} else {
+			buf = net_buf_alloc_with_data(shm->slice_pool, rec + 1, rec->len,
+						      K_NO_WAIT);
+			if (!buf) {
+				return count > 0 ? count : -ENOBUFS;
+			}
+			shm->slice_pos[net_buf_id(buf)] = shm->read;
+			next = shm->read + shm_record_bytes(rec);
+		}
+
+		k_spinlock_key_t key = k_spin_lock(&shm->rx_lock);
+
+		shm->read = next;
+		shm_rx_reclaim(shm);
+		k_spin_unlock(&shm->rx_lock, key);
+
+		if (!buf) {
+			continue;
+		}
+
+		/* Access user_data directly - the slice has no timestamp yet */
+		struct weave_packet_metadata *meta = net_buf_user_data(buf);
+
+		meta->packet_id = rec->packet_id;
+		meta->client_id = rec->client_id;
+		meta->counter = rec->counter;
+#ifdef CONFIG_WEAVE_PACKET_TIMESTAMP_HIRES
+		meta->cycles = k_cycle_get_64();
+#else
+		meta->ticks = k_uptime_ticks();
+#endif
+
+		atomic_inc(&shm->rx_packets);
+		count++;
+		weave_packet_send(shm->source, buf, K_NO_WAIT);
+	}
+
+	return count;
+}
+
+/* ============================ Transport Functions ============================ */
+
+int weave_packet_shm_init(struct weave_packet_shm *shm, k_timeout_t timeout)
+{
+	if (!shm || !shm->name || !shm->slice_pool || !shm->slice_pos || !shm->source ||
+	    shm->side > 1) {
+		return -EINVAL;
+	}
+
+	k_timepoint_t deadline = sys_timepoint_calc(timeout);
+	size_t size = shm_region_bytes(shm->ring_size);
+	struct shm_header *header;
+	int ret;
+
+	while (true) {
+		ret = weave_shm_adapt_map(shm->name, size, shm->side == 0, (void **)&header);
+		if (ret == 0 && shm->side == 0) {
+			/* Fresh object - zero filled */
+			for (int i = 0; i < 2; i++) {
+				shm_ring(header, shm->ring_size, i)->size = shm->ring_size;
+			}
+			header->ring_size = shm->ring_size;
+			atomic_set(&header->magic, SHM_MAGIC);
+			break;
+		}
+
+		if (ret == 0) {
+			/* Side 1 - wait until side 0 has set up the rings */
+			while (atomic_get(&header->magic) != SHM_MAGIC &&
+			       !sys_timepoint_expired(deadline)) {
+				k_sleep(K_MSEC(1));
+			}
+
+			if (atomic_get(&header->magic) == SHM_MAGIC) {
+				break;
+			}
+		} else if (shm->side == 0) {
+			LOG_ERR("Failed to create %s: %d", shm->name, ret);
+			return ret;
+		}
+
+		if (sys_timepoint_expired(deadline)) {
+			return -EAGAIN;
+		}
+
+		/* Side 0 has not created the object yet */
+		k_sleep(K_MSEC(10));
+	}
+
+	if (header->ring_size != shm->ring_size) {
+		LOG_ERR("Ring size mismatch: %u vs %u", header->ring_size, shm->ring_size);
+		return -EINVAL;
+	}
+
+	shm->tx = shm_ring(header, shm->ring_size, shm->side);
+	shm->rx = shm_ring(header, shm->ring_size, !shm->side);
+	shm->read = atomic_get(&shm->rx->tail);
+
+	LOG_DBG("Attached to %s as side %u", shm->name, shm->side);
+
+	return 0;
+}
+
+int weave_packet_shm_receive(struct weave_packet_shm *shm, k_timeout_t timeout)
+{
+	if (!shm || !shm->rx) {
+		return -EINVAL;
+	}
+
+	k_timepoint_t deadline = sys_timepoint_calc(timeout);
+
+	while (true) {
+		/* Read the doorbell first, so a write after the drain is not missed */
+		uint32_t seen = *(volatile uint32_t *)&shm->rx->doorbell;
+		int ret = shm_rx_drain(shm);
+
+		if (ret > 0) {
+			return ret;
+		}
+
+		if (sys_timepoint_expired(deadline)) {
+			return -EAGAIN;
+		}
+
+		/* Catch a record that arrives within the spin window without a
+		 * full tick of latency, then let the other threads run
+		 */
+		if (ret == -ENOBUFS ||
+		    !weave_shm_adapt_wait(&shm->rx->doorbell, &shm->rx->sleeping, seen,
+					  CONFIG_WEAVE_PACKET_SHM_SPIN_US)) {
+			k_sleep(K_TICKS(1));
+		}
+	}
+}
+
+void weave_packet_shm_handler(struct net_buf *buf, void *user_data)
+{
+	struct weave_packet_shm *shm = user_data;
+	struct weave_packet_shm_ring *tx = shm->tx;
+	size_t len = net_buf_frags_len(buf);
+
+	if (!tx || len > UINT16_MAX) {
+		atomic_inc(&shm->tx_dropped);
+		return;
+	}
+
+	uint32_t need = ROUND_UP(sizeof(struct shm_record) + len, SHM_RECORD_ALIGN);
+	k_spinlock_key_t key = k_spin_lock(&shm->tx_lock);
+	uint32_t head = atomic_get(&tx->head);
+	uint32_t to_end = tx->size - (head & (tx->size - 1));
+	uint32_t pad = need > to_end ? to_end : 0;
+
+	/* Records never wrap - pad to the end of the ring first */
+	if (need + pad > tx->size - (head - (uint32_t)atomic_get(&tx->tail))) {
+		atomic_inc(&shm->tx_dropped);
+		k_spin_unlock(&shm->tx_lock, key);
+		LOG_DBG("TX ring full, dropped packet");
+		return;
+	}
+
+	if (pad) {
+		shm_record_at(tx, head)->flags = SHM_RECORD_PAD;
+		head += pad;
+	}
+
+	struct shm_record *rec = shm_record_at(tx, head);
+	struct weave_packet_metadata *meta = weave_packet_get_meta(buf);
+
+	*rec = (struct shm_record){
+		.len = len,
+		.packet_id = meta ? meta->packet_id : WEAVE_PACKET_ID_ANY,
+		.client_id = meta ? meta->client_id : 0,
+		.counter = meta ? meta->counter : 0,
+	};
+	net_buf_linearize(rec + 1, len, buf, 0, len);
+
+	/* Publish the record, then ring */
+	atomic_set(&tx->head, head + need);
+	atomic_inc(&shm->tx_packets);
+	k_spin_unlock(&shm->tx_lock, key);
+
+	weave_shm_adapt_ring(&tx->doorbell, &tx->sleeping);
+}
+
+void weave_packet_shm_slice_release(struct weave_packet_shm *shm, struct net_buf *buf)
+{
+	/* net_buf_unref() has already cleared the data pointers */
+	struct shm_record *rec = shm_record_at(shm->rx, shm->slice_pos[net_buf_id(buf)]);
+	k_spinlock_key_t key = k_spin_lock(&shm->rx_lock);
+
+	rec->flags |= SHM_RECORD_RELEASED;
+	shm_rx_reclaim(shm);
+	k_spin_unlock(&shm->rx_lock, key);
+
+	net_buf_destroy(buf);
+}
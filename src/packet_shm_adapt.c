@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Host side of the weave shared memory transport (native_sim)
+ *
+ * Built into the native simulator runner against the host C library.
+ */
+
+#include <errno.h>
+#include <fcntl.h>
+#include <linux/futex.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "packet_shm_adapt.h"
+
+int weave_shm_adapt_map(const char *name, uint32_t size, int create, void **addr)
+{
+	int flags = O_RDWR;
+	int fd;
+
+	if (create) {
+		/* Drop a stale object left by an earlier run */
+		shm_unlink(name);
+		flags |= O_CREAT | O_EXCL;
+	}
+
+	fd = shm_open(name, flags, 0600);
+	if (fd < 0) {
+		return -errno;
+	}
+
+	if (create && ftruncate(fd, size) < 0) {
+		int err = errno;
+
+		close(fd);
+		return -err;
+	}
+
+	void *ptr = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+	int err = errno;
+
+	/* The mapping stays valid after close */
+	close(fd);
+
+	if (ptr == MAP_FAILED) {
+		return -err;
+	}
+
+	*addr = ptr;
+	return 0;
+}
+
+void weave_shm_adapt_ring(uint32_t *doorbell, uint32_t *sleeping)
+{
+	__atomic_fetch_add(doorbell, 1, __ATOMIC_SEQ_CST);
+
+	if (__atomic_load_n(sleeping, __ATOMIC_SEQ_CST)) {
+		syscall(SYS_futex, doorbell, FUTEX_WAKE, 1, NULL, NULL, 0);
+	}
+}
+
+int weave_shm_adapt_wait(uint32_t *doorbell, uint32_t *sleeping, uint32_t seen,
+			 uint32_t timeout_us)
+{
+	struct timespec ts = {
+		.tv_sec = timeout_us / 1000000,
+		.tv_nsec = (timeout_us % 1000000) * 1000,
+	};
+
+	/* Announce the sleeper before the final check, so a ring in between wakes us */
+	__atomic_store_n(sleeping, 1, __ATOMIC_SEQ_CST);
+
+	if (__atomic_load_n(doorbell, __ATOMIC_SEQ_CST) == seen) {
+		syscall(SYS_futex, doorbell, FUTEX_WAIT, seen, &ts, NULL, 0);
+	}
+
+	__atomic_store_n(sleeping, 0, __ATOMIC_SEQ_CST);
+
+	return __atomic_load_n(doorbell, __ATOMIC_SEQ_CST) != seen;
+}
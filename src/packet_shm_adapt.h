@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Host side of the weave shared memory transport (native_sim)
+ *
+ * Compiled against the host C library. Keep free of Zephyr headers.
+ */
+
+#ifndef WEAVE_PACKET_SHM_ADAPT_H_
+#define WEAVE_PACKET_SHM_ADAPT_H_
+
+#include <stdint.h>
+
+/**
+ * @brief Map a POSIX shared memory object
+ *
+ * @param name Object name
+ * @param size Object size in bytes
+ * @param create Non-zero to replace any existing object with a new one
+ * @param addr Mapped address on success
+ *
+ * @return 0 on success, negative host errno on failure
+ */
+int weave_shm_adapt_map(const char *name, uint32_t size, int create, void **addr);
+
+/**
+ * @brief Increment a doorbell and wake its sleeper, if any
+ */
+void weave_shm_adapt_ring(uint32_t *doorbell, uint32_t *sleeping);
+
+/**
+ * @brief Sleep on a doorbell until it differs from seen
+ *
+ * Blocks the whole simulated CPU, so keep timeout_us short.
+ *
+ * @return 1 if the doorbell rang, 0 on timeout
+ */
+int weave_shm_adapt_wait(uint32_t *doorbell, uint32_t *sleeping, uint32_t seen,
+			 uint32_t timeout_us);
+
+#endif /* WEAVE_PACKET_SHM_ADAPT_H_ */
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Packet UART - COBS-framed packet transport
+ */
+
+#include <weave/packet_uart.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(weave_packet_uart, CONFIG_WEAVE_LOG_LEVEL);
+
+/* ============================ RX Buffers ============================ */
+
+/**
+ * @brief Take an RX buffer from the pool and remember it until released
+ */
+static struct net_buf *uart_rx_buf_get(struct weave_packet_uart *uart)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(uart->rx_bufs); i++) {
+		if (uart->rx_bufs[i]) {
+			continue;
+		}
+
+		struct net_buf *buf = net_buf_alloc(uart->rx_pool->pool, K_NO_WAIT);
+
+		if (!buf) {
+			LOG_DBG("No RX buffer (pool exhausted)");
+		}
+
+		uart->rx_bufs[i] = buf;
+		return buf;
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Return an RX buffer the driver is done with to the pool
+ */
+static void uart_rx_buf_put(struct weave_packet_uart *uart, const uint8_t *data)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(uart->rx_bufs); i++) {
+		struct net_buf *buf = uart->rx_bufs[i];
+
+		if (buf && buf->data == data) {
+			uart->rx_bufs[i] = NULL;
+			net_buf_unref(buf);
+			return;
+		}
+	}
+}
+
+static int uart_rx_start(struct weave_packet_uart *uart)
+{
+	struct net_buf *buf = uart_rx_buf_get(uart);
+
+	if (!buf) {
+		return -ENOMEM;
+	}
+
+	int ret = uart_rx_enable(uart->dev, buf->data, buf->size,
+				 CONFIG_WEAVE_PACKET_UART_RX_TIMEOUT_US);
+
+	if (ret < 0) {
+		uart_rx_buf_put(uart, buf->data);
+	}
+
+	return ret;
+}
+
+/**
+ * @brief Restart RX, or retry later if it cannot be restarted now
+ *
+ * Fails with -ENOMEM while received packets hold every pool buffer; one
+ * frees up as the application releases them.
+ */
+static void uart_rx_restart(struct weave_packet_uart *uart)
+{
+	int ret = uart_rx_start(uart);
+
+	if (ret < 0) {
+		LOG_DBG("Failed to restart RX: %d", ret);
+		atomic_inc(&uart->rx_restart_failed);
+		k_work_reschedule(&uart->rx_restart, K_MSEC(CONFIG_WEAVE_PACKET_UART_RX_RETRY_MS));
+	}
+}
+
+/* ============================ UART Callback ============================ */
+
+static void uart_callback(const struct device *dev, struct uart_event *evt, void *user_data)
+{
+	struct weave_packet_uart *uart = user_data;
+	struct net_buf *buf;
+
+	if (weave_packet_aio_uart_event(uart->aio, evt)) {
+		return;
+	}
+
+	switch (evt->type) {
+	case UART_RX_RDY:
+		weave_packet_cobs_decode(&uart->decoder, evt->data.rx.buf + evt->data.rx.offset,
+					 evt->data.rx.len);
+		break;
+	case UART_RX_BUF_REQUEST:
+		/* Without a next buffer the driver disables RX when this one is full */
+		buf = uart_rx_buf_get(uart);
+		if (buf && uart_rx_buf_rsp(dev, buf->data, buf->size) < 0) {
+			uart_rx_buf_put(uart, buf->data);
+		}
+		break;
+	case UART_RX_BUF_RELEASED:
+		uart_rx_buf_put(uart, evt->data.rx_buf.buf);
+		break;
+	case UART_RX_STOPPED:
+		/* Line error - the frame in progress is lost */
+		atomic_inc(&uart->rx_stopped);
+		weave_packet_cobs_decoder_reset(&uart->decoder);
+		break;
+	case UART_RX_DISABLED:
+		uart_rx_restart(uart);
+		break;
+	default:
+		break;
+	}
+}
+
+/* ============================ Transport Functions ============================ */
+
+int weave_packet_uart_init(struct weave_packet_uart *uart)
+{
+	if (!uart || !uart->dev || !uart->aio || !uart->rx_pool || !uart->tx_pool) {
+		return -EINVAL;
+	}
+
+	if (!device_is_ready(uart->dev)) {
+		return -ENODEV;
+	}
+
+	int ret = uart_callback_set(uart->dev, uart_callback, uart);
+
+	if (ret < 0) {
+		return ret;
+	}
+
+	return uart_rx_start(uart);
+}
+
+void weave_packet_uart_rx_restart_handler(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct weave_packet_uart *uart = CONTAINER_OF(dwork, struct weave_packet_uart, rx_restart);
+
+	uart_rx_restart(uart);
+}
+
+void weave_packet_uart_handler(struct net_buf *buf, void *user_data)
+{
+	struct weave_packet_uart *uart = user_data;
+	struct net_buf *frame = weave_packet_cobs_encode(buf, uart->tx_pool, K_NO_WAIT);
+
+	if (!frame) {
+		atomic_inc(&uart->tx_dropped);
+		return;
+	}
+
+	weave_packet_aio_write(uart->aio, frame);
+}
@@ -0,0 +1,294 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Packet UDP - datagram packet transport
+ */
+
+#include <weave/packet_udp.h>
+#include <zephyr/logging/log.h>
+#include <errno.h>
+
+LOG_MODULE_REGISTER(weave_packet_udp, CONFIG_WEAVE_LOG_LEVEL);
+
+/* Maximum fragments gathered into one datagram */
+#define UDP_IOV_MAX 8
+
+/* ============================ Peer Table ============================ */
+
+static bool udp_addr_equal(const struct sockaddr *a, const struct sockaddr *b)
+{
+	if (a->sa_family != b->sa_family) {
+		return false;
+	}
+
+	if (a->sa_family == AF_INET) {
+		return net_sin(a)->sin_port == net_sin(b)->sin_port &&
+		       net_sin(a)->sin_addr.s_addr == net_sin(b)->sin_addr.s_addr;
+	}
+
+	if (a->sa_family == AF_INET6) {
+		return net_sin6(a)->sin6_port == net_sin6(b)->sin6_port &&
+		       net_ipv6_addr_cmp(&net_sin6(a)->sin6_addr, &net_sin6(b)->sin6_addr);
+	}
+
+	return false;
+}
+
+/**
+ * @brief Look up a peer, adding it if new. Call with lock held.
+ *
+ * @return client_id of the peer, or -ENOMEM if the table is full
+ */
+static int udp_peer_get_id(struct weave_packet_udp *udp, const struct sockaddr *addr,
+			   socklen_t addrlen)
+{
+	for (uint8_t i = 0; i < udp->num_peers; i++) {
+		if (udp_addr_equal(&udp->peers[i].addr, addr)) {
+			return i + 1;
+		}
+	}
+
+	if (udp->num_peers == udp->max_peers) {
+		return -ENOMEM;
+	}
+
+	struct weave_packet_udp_peer *peer = &udp->peers[udp->num_peers++];
+
+	memcpy(&peer->addr, addr, MIN(addrlen, sizeof(peer->addr)));
+	peer->addrlen = addrlen;
+
+	return udp->num_peers;
+}
+
+/**
+ * @brief Send one datagram to a peer
+ */
+static void udp_send_to(struct weave_packet_udp *udp, struct msghdr *msg, uint8_t client_id)
+{
+	struct weave_packet_udp_peer peer;
+	k_spinlock_key_t key = k_spin_lock(&udp->lock);
+	bool known = client_id > 0 && client_id <= udp->num_peers;
+
+	if (known) {
+		peer = udp->peers[client_id - 1];
+	}
+	k_spin_unlock(&udp->lock, key);
+
+	if (!known) {
+		LOG_DBG("No peer with client_id %u", client_id);
+		atomic_inc(&udp->tx_dropped);
+		return;
+	}
+
+	msg->msg_name = &peer.addr;
+	msg->msg_namelen = peer.addrlen;
+
+	/* Loss-tolerant: a full socket buffer drops the datagram */
+	if (zsock_sendmsg(udp->sock, msg, ZSOCK_MSG_DONTWAIT) < 0) {
+		LOG_DBG("Send to client_id %u failed: %d", client_id, errno);
+		atomic_inc(&udp->tx_dropped);
+		return;
+	}
+
+	atomic_inc(&udp->tx_packets);
+}
+
+/* ============================ Transport Functions ============================ */
+
+int weave_packet_udp_open(struct weave_packet_udp *udp, const struct sockaddr *local,
+			  socklen_t addrlen)
+{
+	if (!udp || !local || !udp->rx_pool || !udp->source) {
+		return -EINVAL;
+	}
+
+	if (udp->sock >= 0) {
+		return -EALREADY;
+	}
+
+	int sock = zsock_socket(local->sa_family, SOCK_DGRAM, IPPROTO_UDP);
+
+	if (sock < 0) {
+		LOG_ERR("Failed to create socket: %d", errno);
+		return -errno;
+	}
+
+	if (zsock_bind(sock, local, addrlen) < 0) {
+		int err = errno;
+
+		LOG_ERR("Failed to bind socket: %d", err);
+		zsock_close(sock);
+		return -err;
+	}
+
+	udp->sock = sock;
+
+	return 0;
+}
+
+void weave_packet_udp_close(struct weave_packet_udp *udp)
+{
+	if (!udp || udp->sock < 0) {
+		return;
+	}
+
+	zsock_close(udp->sock);
+	udp->sock = -1;
+
+	k_spinlock_key_t key = k_spin_lock(&udp->lock);
+
+	udp->num_peers = 0;
+	k_spin_unlock(&udp->lock, key);
+}
+
+int weave_packet_udp_add_peer(struct weave_packet_udp *udp, const struct sockaddr *addr,
+			      socklen_t addrlen)
+{
+	if (!udp || !addr || addrlen == 0) {
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&udp->lock);
+	int ret = udp_peer_get_id(udp, addr, addrlen);
+
+	k_spin_unlock(&udp->lock, key);
+
+	return ret;
+}
+
+int weave_packet_udp_receive(struct weave_packet_udp *udp)
+{
+	if (!udp || udp->sock < 0) {
+		return -EINVAL;
+	}
+
+	int count = 0;
+
+	/* No recvmmsg() in the socket API - each datagram is one call, but the
+	 * caller polls once per batch rather than once per datagram
+	 */
+	while (count < CONFIG_WEAVE_PACKET_UDP_RX_BATCH) {
+		struct net_buf *buf = weave_packet_alloc(udp->rx_pool, K_NO_WAIT);
+		struct sockaddr from;
+		socklen_t fromlen = sizeof(from);
+		uint8_t discard;
+
+		/* Without a buffer the datagram is still read, to drop it */
+		uint8_t *data = buf ? buf->data : &discard;
+		size_t size = buf ? net_buf_tailroom(buf) : sizeof(discard);
+		ssize_t len = zsock_recvfrom(udp->sock, data, size,
+					     ZSOCK_MSG_DONTWAIT | ZSOCK_MSG_TRUNC, &from, &fromlen);
+
+		if (len < 0) {
+			int err = errno;
+
+			if (buf) {
+				net_buf_unref(buf);
+			}
+
+			if (err == EAGAIN || err == EWOULDBLOCK) {
+				break;
+			}
+
+			LOG_ERR("Receive failed: %d", err);
+			return count > 0 ? count : -err;
+		}
+
+		count++;
+
+		if (!buf || (size_t)len > size) {
+			LOG_DBG("Dropped %zd byte datagram (%s)", len,
+				buf ? "too long" : "no buffer");
+			atomic_inc(&udp->rx_dropped);
+			if (buf) {
+				net_buf_unref(buf);
+			}
+			continue;
+		}
+
+		k_spinlock_key_t key = k_spin_lock(&udp->lock);
+		int client_id = udp_peer_get_id(udp, &from, fromlen);
+
+		k_spin_unlock(&udp->lock, key);
+
+		if (client_id < 0) {
+			LOG_DBG("Peer table full, dropped datagram");
+			atomic_inc(&udp->rx_dropped);
+			net_buf_unref(buf);
+			continue;
+		}
+
+		net_buf_add(buf, len);
+		weave_packet_set_client_id(buf, client_id);
+		atomic_inc(&udp->rx_packets);
+		weave_packet_send(udp->source, buf, K_NO_WAIT);
+	}
+
+	if (count > 0) {
+		atomic_inc(&udp->rx_batches);
+	}
+
+	return count;
+}
+
+/**
+ * @brief Send one packet as a datagram to the peer of its client_id
+ */
+static void udp_send_packet(struct weave_packet_udp *udp, struct net_buf *buf)
+{
+	struct iovec iov[UDP_IOV_MAX];
+	size_t iov_len = 0;
+	uint8_t client_id = WEAVE_PACKET_UDP_ALL_PEERS;
+
+	/* One datagram per packet - gather the fragments */
+	for (struct net_buf *frag = buf; frag; frag = frag->frags) {
+		if (iov_len == ARRAY_SIZE(iov)) {
+			LOG_DBG("Too many fragments, dropped packet");
+			atomic_inc(&udp->tx_dropped);
+			return;
+		}
+
+		iov[iov_len].iov_base = frag->data;
+		iov[iov_len].iov_len = frag->len;
+		iov_len++;
+	}
+
+	struct msghdr msg = {
+		.msg_iov = iov,
+		.msg_iovlen = iov_len,
+	};
+
+	(void)weave_packet_get_client_id(buf, &client_id);
+
+	if (client_id != WEAVE_PACKET_UDP_ALL_PEERS) {
+		udp_send_to(udp, &msg, client_id);
+		return;
+	}
+
+	/* num_peers only grows while open, so a stale count is safe */
+	for (uint8_t id = 1; id <= udp->num_peers; id++) {
+		udp_send_to(udp, &msg, id);
+	}
+}
+
+void weave_packet_udp_handler(struct net_buf *const *bufs, size_t count, void *user_data)
+{
+	struct weave_packet_udp *udp = user_data;
+
+	if (udp->sock < 0) {
+		atomic_add(&udp->tx_dropped, count);
+		return;
+	}
+
+	/* No sendmmsg() in the socket API - one call per datagram, but the
+	 * whole batch is sent from one wake-up of the serving thread
+	 */
+	for (size_t i = 0; i < count; i++) {
+		udp_send_packet(udp, bufs[i]);
+	}
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file
+ * @brief Weave Packet Wire - compact variable-length packet header
+ */
+
+#include <weave/packet_wire.h>
+#include <errno.h>
+#include <string.h>
+
+/* Bytes of a varint holding up to 16 and 64 bits */
+#define WIRE_VARINT16_MAX 3
+#define WIRE_VARINT64_MAX 10
+
+/* ============================ Varint Coding ============================ */
+
+static inline uint64_t wire_zigzag(int64_t value)
+{
+	return ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+}
+
+static inline int64_t wire_unzigzag(uint64_t value)
+{
+	return (int64_t)(value >> 1) ^ -(int64_t)(value & 1);
+}
+
+static size_t wire_put_varint(uint8_t *out, uint64_t value)
+{
+	size_t len = 0;
+
+	while (value >= 0x80) {
+		out[len++] = (uint8_t)value | 0x80;
+		value >>= 7;
+	}
+	out[len++] = (uint8_t)value;
+
+	return len;
+}
+
+/**
+ * @brief Read a varint of at most max bytes
+ *
+ * @return Bytes read, -EAGAIN if data ends inside it, or -EINVAL if it is
+ *         longer than max bytes
+ */
+static int wire_get_varint(const uint8_t *data, size_t len, size_t max, uint64_t *value)
+{
+	*value = 0;
+
+	for (size_t i = 0; i < max; i++) {
+		if (i == len) {
+			return -EAGAIN;
+		}
+
+		*value |= (uint64_t)(data[i] & 0x7F) << (7 * i);
+		if (!(data[i] & 0x80)) {
+			return i + 1;
+		}
+	}
+
+	return -EINVAL;
+}
+
+/* ============================ Wire Functions ============================ */
+
+int weave_packet_wire_encode(struct weave_packet_wire_ctx *ctx,
+			     const struct weave_packet_wire_hdr *hdr, uint8_t *out, size_t size)
+{
+	if (!ctx || !hdr || !out || (hdr->flags & ~WEAVE_PACKET_WIRE_F_FIELDS)) {
+		return -EINVAL;
+	}
+
+	/* Encode into scratch first, so a short out is left untouched */
+	uint8_t tmp[WEAVE_PACKET_WIRE_HDR_MAX];
+	uint8_t flags = hdr->flags;
+	bool sync = !ctx->synced;
+	size_t len = 1;
+
+	if (sync) {
+		flags |= WEAVE_PACKET_WIRE_F_SYNC;
+	}
+
+	len += wire_put_varint(&tmp[len], hdr->len);
+
+	if (flags & WEAVE_PACKET_WIRE_F_ID) {
+		tmp[len++] = hdr->packet_id;
+	}
+
+	if (flags & WEAVE_PACKET_WIRE_F_CLIENT_ID) {
+		tmp[len++] = hdr->client_id;
+	}
+
+	if (flags & WEAVE_PACKET_WIRE_F_COUNTER) {
+		int16_t delta = (int16_t)(hdr->counter - ctx->counter);
+
+		len += wire_put_varint(&tmp[len], sync ? hdr->counter : wire_zigzag(delta));
+	}
+
+	if (flags & WEAVE_PACKET_WIRE_F_TIMESTAMP) {
+		int64_t delta = (int64_t)(hdr->timestamp_ns - ctx->timestamp_ns);
+
+		len += wire_put_varint(&tmp[len], sync ? hdr->timestamp_ns : wire_zigzag(delta));
+	}
+
+	if (len > size) {
+		return -ENOMEM;
+	}
+
+	tmp[0] = flags;
+	memcpy(out, tmp, len);
+
+	/* A sync header restarts the deltas from the fields it carries */
+	if (sync) {
+		ctx->counter = 0;
+		ctx->timestamp_ns = 0;
+		ctx->synced = true;
+	}
+	if (flags & WEAVE_PACKET_WIRE_F_COUNTER) {
+		ctx->counter = hdr->counter;
+	}
+	if (flags & WEAVE_PACKET_WIRE_F_TIMESTAMP) {
+		ctx->timestamp_ns = hdr->timestamp_ns;
+	}
+
+	return len;
+}
+
+int weave_packet_wire_decode(struct weave_packet_wire_ctx *ctx, const uint8_t *data, size_t len,
+			     struct weave_packet_wire_hdr *hdr)
+{
+	if (!ctx || !data || !hdr) {
+		return -EINVAL;
+	}
+
+	if (len == 0) {
+		return -EAGAIN;
+	}
+
+	uint8_t flags = data[0];
+	size_t pos = 1;
+	uint64_t value;
+	int ret;
+
+	if (flags & ~(WEAVE_PACKET_WIRE_F_FIELDS | WEAVE_PACKET_WIRE_F_SYNC)) {
+		return -EINVAL;
+	}
+
+	ret = wire_get_varint(&data[pos], len - pos, WIRE_VARINT16_MAX, &value);
+	if (ret < 0) {
+		return ret;
+	}
+	if (value > UINT16_MAX) {
+		return -EINVAL;
+	}
+	pos += ret;
+
+	*hdr = (struct weave_packet_wire_hdr){
+		.flags = flags & WEAVE_PACKET_WIRE_F_FIELDS,
+		.len = value,
+	};
+
+	if (flags & WEAVE_PACKET_WIRE_F_ID) {
+		if (pos == len) {
+			return -EAGAIN;
+		}
+		hdr->packet_id = data[pos++];
+	}
+
+	if (flags & WEAVE_PACKET_WIRE_F_CLIENT_ID) {
+		if (pos == len) {
+			return -EAGAIN;
+		}
+		hdr->client_id = data[pos++];
+	}
+
+	bool sync = flags & WEAVE_PACKET_WIRE_F_SYNC;
+	struct weave_packet_wire_ctx next = {
+		.counter = sync ? 0 : ctx->counter,
+		.timestamp_ns = sync ? 0 : ctx->timestamp_ns,
+		.synced = sync || ctx->synced,
+	};
+
+	if (flags & WEAVE_PACKET_WIRE_F_COUNTER) {
+		ret = wire_get_varint(&data[pos], len - pos, WIRE_VARINT16_MAX, &value);
+		if (ret < 0) {
+			return ret;
+		}
+		if (value > UINT16_MAX) {
+			return -EINVAL;
+		}
+		pos += ret;
+
+		next.counter = sync ? value : next.counter + (uint16_t)wire_unzigzag(value);
+		hdr->counter = next.counter;
+	}
+
+	if (flags & WEAVE_PACKET_WIRE_F_TIMESTAMP) {
+		ret = wire_get_varint(&data[pos], len - pos, WIRE_VARINT64_MAX, &value);
+		if (ret < 0) {
+			return ret;
+		}
+		pos += ret;
+
+		if (!sync) {
+			value = next.timestamp_ns + (uint64_t)wire_unzigzag(value);
+		}
+		next.timestamp_ns = value;
+		hdr->timestamp_ns = next.timestamp_ns;
+	}
+
+	/* Deltas without a base carry no value */
+	if (!next.synced) {
+		hdr->flags &= ~(WEAVE_PACKET_WIRE_F_COUNTER | WEAVE_PACKET_WIRE_F_TIMESTAMP);
+		hdr->counter = 0;
+		hdr->timestamp_ns = 0;
+	}
+
+	*ctx = next;
+
+	return pos;
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <weave/poll.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/zvfs/eventfd.h>
+#include <errno.h>
+
+LOG_MODULE_REGISTER(weave_poll, CONFIG_WEAVE_LOG_LEVEL);
+
+/* ============================ Internal Helpers ============================ */
+
+/**
+ * @brief Create the eventfd of a pollable queue on first use
+ */
+static int poll_queue_open(struct weave_poll_queue *pq)
+{
+	if (pq->fd >= 0) {
+		return 0;
+	}
+
+	int fd = zvfs_eventfd(0, ZVFS_EFD_NONBLOCK);
+
+	if (fd < 0) {
+		LOG_ERR("Failed to create eventfd: %d", errno);
+		return -errno;
+	}
+
+	pq->fd = fd;
+	return 0;
+}
+
+/* ============================ Poll Functions ============================ */
+
+struct weave_poll_queue *weave_poll_queue_find(struct k_msgq *queue)
+{
+	STRUCT_SECTION_FOREACH(weave_poll_queue, pq) {
+		if (pq->queue == queue) {
+			return pq;
+		}
+	}
+
+	return NULL;
+}
+
+void weave_poll_notify(struct weave_poll_queue *pq)
+{
+	/* One signal per idle period - the consumer drains everything on wakeup */
+	if (pq->fd >= 0 && atomic_cas(&pq->signalled, 0, 1)) {
+		zvfs_eventfd_write(pq->fd, 1);
+	}
+}
+
+int weave_poll(struct zsock_pollfd *fds, int nfds, struct weave_poll_queue *const *queues,
+	       size_t nqueues, int timeout_ms)
+{
+	struct zsock_pollfd all[CONFIG_WEAVE_POLL_MAX_FDS];
+
+	if (nfds < 0 || (nfds > 0 && !fds) || (nqueues > 0 && !queues) ||
+	    (size_t)nfds + nqueues > ARRAY_SIZE(all)) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < nqueues; i++) {
+		int ret = poll_queue_open(queues[i]);
+
+		if (ret < 0) {
+			return ret;
+		}
+
+		/* Events queued before the eventfd existed have no signal */
+		if (k_msgq_num_used_get(queues[i]->queue) > 0) {
+			timeout_ms = 0;
+		}
+
+		all[nfds + i] = (struct zsock_pollfd){
+			.fd = queues[i]->fd,
+			.events = ZSOCK_POLLIN,
+		};
+	}
+
+	for (int i = 0; i < nfds; i++) {
+		all[i] = fds[i];
+	}
+
+	if (zsock_poll(all, nfds + nqueues, timeout_ms) < 0) {
+		return -errno;
+	}
+
+	for (size_t i = 0; i < nqueues; i++) {
+		struct weave_poll_queue *pq = queues[i];
+		zvfs_eventfd_t value;
+
+		if (!(all[nfds + i].revents & ZSOCK_POLLIN) &&
+		    k_msgq_num_used_get(pq->queue) == 0) {
+			continue;
+		}
+
+		/* Re-arm before draining so later enqueues signal again */
+		zvfs_eventfd_read(pq->fd, &value);
+		atomic_clear(&pq->signalled);
+
+		weave_process_messages(pq->queue, K_NO_WAIT);
+	}
+
+	int ready = 0;
+
+	for (int i = 0; i < nfds; i++) {
+		fds[i].revents = all[i].revents;
+		if (fds[i].revents) {
+			ready++;
+		}
+	}
+
+	return ready;
+}
@@ -81,6 +81,21 @@ static const struct weave_payload_ops test_filter_ops = {
 	.unref = test_unref,
 };
 
+/* Dedicated filter - rejects sinks with user_data == NULL, never takes refs */
+static int test_filter(void *ptr, struct weave_sink *sink)
+{
+	ARG_UNUSED(ptr);
+	atomic_inc(&filter_count);
+	return sink->user_data ? 0 : -EACCES;
+}
+
+/* Ops with separate filter - queued sinks sharing a queue share one ref */
+static const struct weave_payload_ops test_group_ops = {
+	.filter = test_filter,
+	.ref = test_ref,
+	.unref = test_unref,
+};
+
 /* =============================================================================
  * Test Capture Context - Track handler invocations
  * =============================================================================
@@ -130,6 +145,12 @@ WEAVE_MSGQ_DEFINE(null_sink_queue, 4);    /* For NULL sink test */
 WEAVE_MSGQ_DEFINE(null_handler_queue, 4); /* For NULL handler test */
 WEAVE_MSGQ_DEFINE(no_ops_queue, 4);       /* For no-ops sink test */
 WEAVE_MSGQ_DEFINE(no_unref_queue, 4);     /* For no-unref test */
+WEAVE_MSGQ_DEFINE(group_queue, 8);        /* For multi-target event tests */
+WEAVE_MSGQ_DEFINE(batch_queue, 8);        /* For batch sink tests */
+WEAVE_MSGQ_DEFINE(inline_queue, 8);       /* For same-thread inline tests */
+WEAVE_MSGQ_DEFINE(value_queue, 4);        /* For by-value tests */
+WEAVE_MSGQ_DEFINE(adaptive_queue, 4);     /* For adaptive sink tests */
+WEAVE_MSGQ_DEFINE(flow_queue, 4);         /* For flow control tests */
 
 /* Sources with payload ops */
 static struct weave_source sources[4] = {
@@ -532,6 +553,25 @@ ZTEST(weave_core_unit_test, test_multiple_messages)
 	zassert_equal(atomic_get(&captures[1].count), num_sends, "Queued sink[1]");
 }
 
+ZTEST(weave_core_unit_test, test_process_drains_beyond_batch)
+{
+	/* More events than one bulk dequeue holds - all drained in one call, in order */
+	static int test_data[2 * CONFIG_WEAVE_PROCESS_BATCH_SIZE + 1];
+
+	ARRAY_FOR_EACH(test_data, i) {
+		int ret = weave_sink_send(&sinks[0], &test_data[i], NULL, K_NO_WAIT);
+		zassert_equal(ret, 0, "Send %zu should succeed", i);
+	}
+
+	int processed = weave_process_messages(&test_queue, K_NO_WAIT);
+
+	zassert_equal(processed, ARRAY_SIZE(test_data), "All events processed in one call");
+	zassert_equal(atomic_get(&captures[0].count), ARRAY_SIZE(test_data), "Handler per event");
+	zassert_equal(captures[0].last_ptr, &test_data[ARRAY_SIZE(test_data) - 1],
+		      "Events dispatched in queue order");
+	zassert_equal(k_msgq_num_used_get(&test_queue), 0, "Queue should be drained");
+}
+
 ZTEST(weave_core_unit_test, test_queue_overflow)
 {
 	size_t queued_per_emit = num_queued[0]; /* 2 for source[0] */
@@ -656,6 +696,659 @@ ZTEST(weave_core_unit_test, test_queue_overflow_null_ops)
 	weave_process_messages(&tiny_queue, K_NO_WAIT);
 }
 
+/* =============================================================================
+ * Multi-Target Event Tests (sinks sharing a queue)
+ * =============================================================================
+ */
+
+/* Events needed to carry n targets */
+#define GROUP_EVENTS(n) DIV_ROUND_UP(n, CONFIG_WEAVE_EVENT_MAX_TARGETS)
+
+ZTEST(weave_core_unit_test, test_group_shared_queue_single_ref)
+{
+	k_msgq_purge(&group_queue);
+
+	struct weave_source source = WEAVE_SOURCE_INITIALIZER(group, &test_group_ops);
+	struct weave_sink sink_a =
+		WEAVE_SINK_INITIALIZER(capture_handler, &group_queue, &captures[5]);
+	struct weave_sink sink_b =
+		WEAVE_SINK_INITIALIZER(capture_handler, &group_queue, &captures[6]);
+	struct weave_sink sink_c =
+		WEAVE_SINK_INITIALIZER(capture_handler, WV_IMMEDIATE, &captures[7]);
+
+	static struct weave_connection conn_a, conn_b, conn_c;
+	conn_a.source = &source;
+	conn_a.sink = &sink_a;
+	conn_b.source = &source;
+	conn_b.sink = &sink_b;
+	conn_c.source = &source;
+	conn_c.sink = &sink_c;
+	sys_slist_init(&source.sinks);
+	sys_slist_append(&source.sinks, &conn_a.node);
+	sys_slist_append(&source.sinks, &conn_c.node);
+	sys_slist_append(&source.sinks, &conn_b.node);
+
+	int test_data = 0x1010;
+	int ret = weave_source_emit(&source, &test_data, K_NO_WAIT);
+
+	zassert_equal(ret, 3, "Should deliver to all 3 sinks");
+	zassert_equal(atomic_get(&filter_count), 3, "Filter checked for every sink");
+	zassert_equal(k_msgq_num_used_get(&group_queue), GROUP_EVENTS(2),
+		      "Queued sinks sharing a queue should be grouped");
+	zassert_equal(atomic_get(&ref_count), 1 + GROUP_EVENTS(2), "One ref per event");
+	zassert_equal(atomic_get(&captures[7].count), 1, "Immediate sink called during emit");
+
+	int processed = weave_process_messages(&group_queue, K_NO_WAIT);
+
+	zassert_equal(processed, 2, "Both queued handlers invoked");
+	zassert_equal(atomic_get(&captures[5].count), 1, "Sink A called");
+	zassert_equal(atomic_get(&captures[6].count), 1, "Sink B called");
+	zassert_equal(captures[6].last_ptr, &test_data, "Sink B received correct ptr");
+	zassert_equal(atomic_get(&unref_count), atomic_get(&ref_count), "Every ref released");
+}
+
+ZTEST(weave_core_unit_test, test_group_filter_per_sink)
+{
+	k_msgq_purge(&group_queue);
+
+	struct weave_source source = WEAVE_SOURCE_INITIALIZER(group_filter, &test_group_ops);
+	struct weave_sink sink_reject = WEAVE_SINK_INITIALIZER(capture_handler, &group_queue, NULL);
+	struct weave_sink sink_a =
+		WEAVE_SINK_INITIALIZER(capture_handler, &group_queue, &captures[5]);
+	struct weave_sink sink_b =
+		WEAVE_SINK_INITIALIZER(capture_handler, &group_queue, &captures[6]);
+
+	static struct weave_connection conn_r, conn_a, conn_b;
+	conn_r.source = &source;
+	conn_r.sink = &sink_reject;
+	conn_a.source = &source;
+	conn_a.sink = &sink_a;
+	conn_b.source = &source;
+	conn_b.sink = &sink_b;
+	sys_slist_init(&source.sinks);
+	sys_slist_append(&source.sinks, &conn_r.node);
+	sys_slist_append(&source.sinks, &conn_a.node);
+	sys_slist_append(&source.sinks, &conn_b.node);
+
+	int test_data = 0x2020;
+	int ret = weave_source_emit(&source, &test_data, K_NO_WAIT);
+
+	zassert_equal(ret, 2, "Filtered sink should be skipped");
+	zassert_equal(k_msgq_num_used_get(&group_queue), GROUP_EVENTS(2),
+		      "Only accepted sinks are carried");
+	zassert_equal(atomic_get(&ref_count), GROUP_EVENTS(2), "No ref for filtered sink");
+
+	int processed = weave_process_messages(&group_queue, K_NO_WAIT);
+
+	zassert_equal(processed, 2, "Accepted handlers invoked");
+	zassert_equal(atomic_get(&captures[5].count), 1, "Sink A called");
+	zassert_equal(atomic_get(&captures[6].count), 1, "Sink B called");
+	zassert_equal(atomic_get(&unref_count), GROUP_EVENTS(2), "One unref per event");
+}
+
+ZTEST(weave_core_unit_test, test_group_split_beyond_max_targets)
+{
+	k_msgq_purge(&group_queue);
+
+	struct weave_source source = WEAVE_SOURCE_INITIALIZER(group_split, &test_group_ops);
+	struct weave_sink group_sinks[CONFIG_WEAVE_EVENT_MAX_TARGETS + 1];
+	static struct weave_connection conns[CONFIG_WEAVE_EVENT_MAX_TARGETS + 1];
+
+	sys_slist_init(&source.sinks);
+	ARRAY_FOR_EACH(group_sinks, i) {
+		group_sinks[i] = (struct weave_sink)WEAVE_SINK_INITIALIZER(
+			capture_handler, &group_queue, &captures[i % ARRAY_SIZE(captures)]);
+		conns[i].source = &source;
+		conns[i].sink = &group_sinks[i];
+		sys_slist_append(&source.sinks, &conns[i].node);
+	}
+
+	int test_data = 0x3030;
+	int ret = weave_source_emit(&source, &test_data, K_NO_WAIT);
+
+	zassert_equal(ret, ARRAY_SIZE(group_sinks), "All sinks delivered");
+	zassert_equal(k_msgq_num_used_get(&group_queue), GROUP_EVENTS(ARRAY_SIZE(group_sinks)),
+		      "Targets beyond the maximum spill into a new event");
+
+	int processed = weave_process_messages(&group_queue, K_NO_WAIT);
+
+	zassert_equal(processed, ARRAY_SIZE(group_sinks), "Every handler invoked");
+	zassert_equal(atomic_get(&unref_count), atomic_get(&ref_count), "Every ref released");
+}
+
+ZTEST(weave_core_unit_test, test_group_queue_full_unref)
+{
+	k_msgq_purge(&tiny_queue);
+
+	struct weave_source source = WEAVE_SOURCE_INITIALIZER(group_full, &test_group_ops);
+	struct weave_sink sink_a =
+		WEAVE_SINK_INITIALIZER(capture_handler, &tiny_queue, &captures[5]);
+	struct weave_sink sink_b =
+		WEAVE_SINK_INITIALIZER(capture_handler, &tiny_queue, &captures[6]);
+
+	static struct weave_connection conn_a, conn_b;
+	conn_a.source = &source;
+	conn_a.sink = &sink_a;
+	conn_b.source = &source;
+	conn_b.sink = &sink_b;
+	sys_slist_init(&source.sinks);
+	sys_slist_append(&source.sinks, &conn_a.node);
+	sys_slist_append(&source.sinks, &conn_b.node);
+
+	/* Fill the single-slot queue */
+	int data1 = 0x4040;
+	int ret = weave_sink_send(&sink_a, &data1, NULL, K_NO_WAIT);
+	zassert_equal(ret, 0, "Direct send should fill the queue");
+
+	int data2 = 0x5050;
+	ret = weave_source_emit(&source, &data2, K_NO_WAIT);
+
+	zassert_equal(ret, 0, "Emit should fail (queue full)");
+	zassert_equal(atomic_get(&unref_count), atomic_get(&ref_count),
+		      "Refs released on failure");
+
+	weave_process_messages(&tiny_queue, K_NO_WAIT);
+}
+
+/* =============================================================================
+ * Per-Sink Release Tests
+ * =============================================================================
+ */
+
+static atomic_t release_count;
+static struct weave_sink *ref_sinks[2];
+static struct weave_sink *release_sinks[2];
+
+/* Ref that records the sink it was taken for */
+static int test_ref_sink(void *ptr, struct weave_sink *sink)
+{
+	ARG_UNUSED(ptr);
+	ref_sinks[atomic_inc(&ref_count) % ARRAY_SIZE(ref_sinks)] = sink;
+	return 0;
+}
+
+/* Release that records the sink it is given */
+static void test_release(void *ptr, struct weave_sink *sink)
+{
+	ARG_UNUSED(ptr);
+	release_sinks[atomic_inc(&release_count) % ARRAY_SIZE(release_sinks)] = sink;
+}
+
+static const struct weave_payload_ops test_release_ops = {
+	.filter = test_filter,
+	.ref = test_ref_sink,
+	.unref = test_unref,
+	.release = test_release,
+};
+
+ZTEST(weave_core_unit_test, test_release_gets_ref_sink)
+{
+	k_msgq_purge(&group_queue);
+
+	struct weave_source source = WEAVE_SOURCE_INITIALIZER(release, &test_release_ops);
+	struct weave_sink sink_queued =
+		WEAVE_SINK_INITIALIZER(capture_handler, &group_queue, &captures[5]);
+	struct weave_sink sink_immediate =
+		WEAVE_SINK_INITIALIZER(capture_handler, WV_IMMEDIATE, &captures[6]);
+
+	static struct weave_connection conn_queued, conn_immediate;
+	conn_queued.source = &source;
+	conn_queued.sink = &sink_queued;
+	conn_immediate.source = &source;
+	conn_immediate.sink = &sink_immediate;
+	sys_slist_init(&source.sinks);
+	sys_slist_append(&source.sinks, &conn_queued.node);
+	sys_slist_append(&source.sinks, &conn_immediate.node);
+
+	atomic_clear(&release_count);
+
+	int test_data = 0x6060;
+	int ret = weave_source_emit(&source, &test_data, K_NO_WAIT);
+
+	zassert_equal(ret, 2, "Should deliver to both sinks");
+	zassert_equal(ref_sinks[0], &sink_queued);
+	zassert_equal(ref_sinks[1], &sink_immediate);
+	zassert_equal(atomic_get(&release_count), 1, "Immediate reference released");
+	zassert_equal(release_sinks[0], &sink_immediate);
+
+	weave_process_messages(&group_queue, K_NO_WAIT);
+
+	zassert_equal(atomic_get(&release_count), 2, "Queued reference released");
+	zassert_equal(release_sinks[1], &sink_queued, "Released for the sink it was taken for");
+	zassert_equal(atomic_get(&unref_count), 0, "Release replaces unref");
+}
+
+/* =============================================================================
+ * Batch Sink Tests
+ * =============================================================================
+ */
+
+#define TEST_BATCH_MAX 3
+
+struct test_batch_capture {
+	size_t calls;
+	size_t items;
+	size_t max_count;
+	void *last_ptr;
+};
+
+static struct test_batch_capture batch_capture;
+
+static void batch_capture_handler(void *const *ptrs, size_t count, void *user_data)
+{
+	struct test_batch_capture *capture = (struct test_batch_capture *)user_data;
+
+	zassert_not_null(capture, "Capture context should not be NULL");
+	zassert_true(count > 0, "Batch should not be empty");
+
+	capture->calls++;
+	capture->items += count;
+	capture->max_count = MAX(capture->max_count, count);
+	capture->last_ptr = ptrs[count - 1];
+}
+
+WEAVE_BATCH_SINK_DEFINE(batch_sink, batch_capture_handler, &batch_queue, TEST_BATCH_MAX,
+			&batch_capture);
+WEAVE_BATCH_SINK_DEFINE(batch_sink_immediate, batch_capture_handler, WV_IMMEDIATE,
+			TEST_BATCH_MAX, &batch_capture);
+
+ZTEST(weave_core_unit_test, test_batch_sink_queued)
+{
+	static int test_data[5];
+
+	memset(&batch_capture, 0, sizeof(batch_capture));
+	k_msgq_purge(&batch_queue);
+
+	ARRAY_FOR_EACH(test_data, i) {
+		int ret = weave_sink_send(&batch_sink.sink, &test_data[i], &test_ops, K_NO_WAIT);
+		zassert_equal(ret, 0, "Send %zu should succeed", i);
+	}
+	zassert_equal(batch_capture.calls, 0, "Handler not called before processing");
+
+	int processed = weave_process_messages(&batch_queue, K_NO_WAIT);
+
+	zassert_equal(processed, ARRAY_SIZE(test_data), "Every payload counted");
+	zassert_equal(batch_capture.items, ARRAY_SIZE(test_data), "Every payload delivered");
+	zassert_true(batch_capture.max_count <= TEST_BATCH_MAX, "Batch bounded by max_batch");
+	zassert_true(batch_capture.max_count <= CONFIG_WEAVE_PROCESS_BATCH_SIZE,
+		     "Batch bounded by process batch size");
+	if (CONFIG_WEAVE_PROCESS_BATCH_SIZE > 1) {
+		zassert_true(batch_capture.calls < ARRAY_SIZE(test_data), "Payloads batched");
+	}
+	zassert_equal(batch_capture.last_ptr, &test_data[ARRAY_SIZE(test_data) - 1],
+		      "Payloads delivered in queue order");
+	zassert_equal(atomic_get(&ref_count), ARRAY_SIZE(test_data), "One ref per payload");
+	zassert_equal(atomic_get(&unref_count), ARRAY_SIZE(test_data), "All refs released");
+}
+
+ZTEST(weave_core_unit_test, test_batch_sink_immediate)
+{
+	int test_data = 0xCCCC;
+
+	memset(&batch_capture, 0, sizeof(batch_capture));
+
+	int ret = weave_sink_send(&batch_sink_immediate.sink, &test_data, &test_ops, K_NO_WAIT);
+	zassert_equal(ret, 0, "Send should succeed");
+	zassert_equal(batch_capture.calls, 1, "Handler called synchronously");
+	zassert_equal(batch_capture.items, 1, "Immediate delivery has count 1");
+	zassert_equal(batch_capture.last_ptr, &test_data, "Should receive correct ptr");
+	zassert_equal(atomic_get(&unref_count), 1, "Ref released after handler");
+}
+
+ZTEST(weave_core_unit_test, test_batch_sink_context)
+{
+	zassert_equal(weave_sink_context(&batch_sink.sink), &batch_capture,
+		      "Batch sink context is the batch user_data");
+	zassert_equal(weave_sink_context(&sinks[0]), &captures[0],
+		      "Plain sink context is its user_data");
+}
+
+/* =============================================================================
+ * Adaptive Sink Tests
+ * =============================================================================
+ */
+
+#define TEST_ADAPTIVE_DEFER_US 200
+
+/* Handler execution time, set per test */
+static uint32_t adaptive_busy_us;
+
+static void adaptive_handler(void *ptr, void *user_data)
+{
+	if (adaptive_busy_us > 0) {
+		k_busy_wait(adaptive_busy_us);
+	}
+	capture_handler(ptr, user_data);
+}
+
+WEAVE_ADAPTIVE_SINK_DEFINE(adaptive_sink, adaptive_handler, &adaptive_queue,
+			   TEST_ADAPTIVE_DEFER_US, &captures[7]);
+
+static void adaptive_reset(void)
+{
+	k_msgq_purge(&adaptive_queue);
+	adaptive_sink.avg_ns = 0;
+	atomic_set(&adaptive_sink.deferred, 1);
+	adaptive_busy_us = 0;
+}
+
+ZTEST(weave_core_unit_test, test_adaptive_sink_fast_handler_goes_immediate)
+{
+	int test_data = 0xADA;
+
+	adaptive_reset();
+	zassert_true(weave_adaptive_sink_is_deferred(&adaptive_sink), "Starts deferred");
+
+	zassert_ok(weave_sink_send(&adaptive_sink.sink, &test_data, &test_ops, K_NO_WAIT));
+	zassert_equal(atomic_get(&captures[7].count), 0, "Deferred delivery is queued");
+	zassert_equal(weave_process_messages(&adaptive_queue, K_NO_WAIT), 1, "One event");
+	zassert_equal(atomic_get(&captures[7].count), 1, "Handler ran from the queue");
+
+	/* The cheap handler was measured, next delivery runs in the producer */
+	zassert_false(weave_adaptive_sink_is_deferred(&adaptive_sink), "Switched to immediate");
+	zassert_ok(weave_sink_send(&adaptive_sink.sink, &test_data, &test_ops, K_NO_WAIT));
+	zassert_equal(atomic_get(&captures[7].count), 2, "Handler ran immediately");
+	zassert_equal(k_msgq_num_used_get(&adaptive_queue), 0, "Nothing queued");
+	zassert_equal(atomic_get(&unref_count), 2, "All refs released");
+}
+
+ZTEST(weave_core_unit_test, test_adaptive_sink_slow_handler_defers)
+{
+	int test_data = 0xADA;
+	int sends = 0;
+
+	adaptive_reset();
+	atomic_set(&adaptive_sink.deferred, 0);
+	adaptive_sink.avg_ns = adaptive_sink.inline_ns / 2; /* History of fast calls */
+
+	/* Slow handler drags the average above the threshold within a few calls */
+	adaptive_busy_us = 5 * TEST_ADAPTIVE_DEFER_US;
+	while (!weave_adaptive_sink_is_deferred(&adaptive_sink) && sends < 8) {
+		zassert_ok(weave_sink_send(&adaptive_sink.sink, &test_data, &test_ops, K_NO_WAIT));
+		sends++;
+	}
+	zassert_true(weave_adaptive_sink_is_deferred(&adaptive_sink), "Switched to deferred");
+	zassert_true(sends > 1, "Single slow call is smoothed by the average");
+	zassert_equal(atomic_get(&captures[7].count), sends, "Immediate calls so far");
+
+	zassert_ok(weave_sink_send(&adaptive_sink.sink, &test_data, &test_ops, K_NO_WAIT));
+	zassert_equal(atomic_get(&captures[7].count), sends, "Producer no longer runs handler");
+	zassert_equal(k_msgq_num_used_get(&adaptive_queue), 1, "Delivery queued");
+
+	adaptive_busy_us = 0;
+	weave_process_messages(&adaptive_queue, K_NO_WAIT);
+	zassert_equal(atomic_get(&captures[7].count), sends + 1, "Queued delivery handled");
+}
+
+ZTEST(weave_core_unit_test, test_adaptive_sink_hysteresis)
+{
+	int test_data = 0xADA;
+
+	adaptive_reset();
+	zassert_equal(adaptive_sink.inline_ns, adaptive_sink.defer_ns / 2, "Band below threshold");
+
+	/* Average inside the band: the current mode is kept either way */
+	adaptive_sink.avg_ns = (adaptive_sink.inline_ns + adaptive_sink.defer_ns) / 2;
+	zassert_ok(weave_sink_send(&adaptive_sink.sink, &test_data, &test_ops, K_NO_WAIT));
+	weave_process_messages(&adaptive_queue, K_NO_WAIT);
+	zassert_true(weave_adaptive_sink_is_deferred(&adaptive_sink), "Stays deferred in band");
+
+	atomic_set(&adaptive_sink.deferred, 0);
+	adaptive_sink.avg_ns = (adaptive_sink.inline_ns + adaptive_sink.defer_ns) / 2;
+	zassert_ok(weave_sink_send(&adaptive_sink.sink, &test_data, &test_ops, K_NO_WAIT));
+	zassert_false(weave_adaptive_sink_is_deferred(&adaptive_sink), "Stays immediate in band");
+
+	zassert_equal(weave_sink_context(&adaptive_sink.sink), &captures[7],
+		      "Adaptive sink context is its user_data");
+}
+
+/* =============================================================================
+ * Same-Thread Inline Delivery Tests
+ * =============================================================================
+ */
+
+static struct weave_sink inline_last =
+	WEAVE_SINK_INITIALIZER(capture_handler, &inline_queue, &captures[7]);
+
+/* First pipeline stage - forwards to the next stage on the same queue */
+static void inline_forward_handler(void *ptr, void *user_data)
+{
+	capture_handler(ptr, user_data);
+	zassert_equal(weave_sink_send(&inline_last, ptr, &test_ops, K_NO_WAIT), 0,
+		      "Forward should succeed");
+	zassert_equal(atomic_get(&captures[7].count),
+		      CONFIG_WEAVE_INLINE_MAX_DEPTH > 0 ? 1 : 0,
+		      "Next stage runs inline only when enabled");
+}
+
+static struct weave_sink inline_first =
+	WEAVE_SINK_INITIALIZER(inline_forward_handler, &inline_queue, &captures[6]);
+
+/* Resends to itself until the payload counter reaches zero */
+static void inline_recurse_handler(void *ptr, void *user_data);
+
+static struct weave_sink inline_recurse =
+	WEAVE_SINK_INITIALIZER(inline_recurse_handler, &inline_queue, &captures[8]);
+
+static void inline_recurse_handler(void *ptr, void *user_data)
+{
+	int *remaining = (int *)ptr;
+
+	capture_handler(ptr, user_data);
+	if (--(*remaining) > 0) {
+		zassert_equal(weave_sink_send(&inline_recurse, ptr, NULL, K_NO_WAIT), 0,
+			      "Resend should succeed");
+	}
+}
+
+ZTEST(weave_core_unit_test, test_inline_same_queue_pipeline)
+{
+	int test_data = 0xDDDD;
+
+	k_msgq_purge(&inline_queue);
+
+	zassert_equal(weave_sink_send(&inline_first, &test_data, &test_ops, K_NO_WAIT), 0,
+		      "Send should succeed");
+	zassert_equal(atomic_get(&captures[6].count), 0, "Sender is not the consumer");
+
+	/* Drain until idle - the second stage is either inline or queued */
+	while (weave_process_messages(&inline_queue, K_NO_WAIT) > 0) {
+	}
+
+	zassert_equal(atomic_get(&captures[6].count), 1, "First stage ran once");
+	zassert_equal(atomic_get(&captures[7].count), 1, "Second stage ran once");
+	zassert_equal(captures[7].last_ptr, &test_data, "Payload forwarded");
+	zassert_equal(atomic_get(&ref_count), atomic_get(&unref_count), "Refs balanced");
+	zassert_equal(k_msgq_num_used_get(&inline_queue), 0, "Queue should be empty");
+}
+
+ZTEST(weave_core_unit_test, test_inline_depth_limit)
+{
+	int remaining = CONFIG_WEAVE_INLINE_MAX_DEPTH + 3;
+	int total = remaining;
+
+	k_msgq_purge(&inline_queue);
+
+	zassert_equal(weave_sink_send(&inline_recurse, &remaining, NULL, K_NO_WAIT), 0,
+		      "Send should succeed");
+
+	/* One processing pass runs the first event plus up to the depth limit inline */
+	weave_process_messages(&inline_queue, K_NO_WAIT);
+	zassert_true(atomic_get(&captures[8].count) >= 1 + CONFIG_WEAVE_INLINE_MAX_DEPTH,
+		     "Inline deliveries up to the depth limit");
+
+	while (weave_process_messages(&inline_queue, K_NO_WAIT) > 0) {
+	}
+
+	zassert_equal(atomic_get(&captures[8].count), total, "Every resend delivered");
+	zassert_equal(remaining, 0, "Counter exhausted");
+}
+
+/* =============================================================================
+ * By-Value Delivery Tests
+ * =============================================================================
+ */
+
+struct test_value {
+	uint32_t a;
+	uint16_t b;
+	uint8_t c;
+};
+
+static struct test_value value_seen[2];
+
+/* Copies the received value, then scribbles over it to prove isolation */
+static void value_handler(void *ptr, void *user_data)
+{
+	struct test_value *value = (struct test_value *)ptr;
+
+	capture_handler(ptr, user_data);
+	value_seen[(struct test_capture *)user_data - &captures[0]] = *value;
+	value->a = 0;
+}
+
+static struct weave_sink value_sinks[2] = {
+	WEAVE_SINK_INITIALIZER(value_handler, WV_IMMEDIATE, &captures[0]),
+	WEAVE_SINK_INITIALIZER(value_handler, &value_queue, &captures[1]),
+};
+
+#if CONFIG_WEAVE_VALUE_MAX_SIZE > 0
+WEAVE_VALUE_SOURCE_DEFINE(value_source, struct test_value);
+WEAVE_CONNECT(&value_source, &value_sinks[0]);
+WEAVE_CONNECT(&value_source, &value_sinks[1]);
+#endif
+
+ZTEST(weave_core_unit_test, test_value_emit_fanout)
+{
+	if (CONFIG_WEAVE_VALUE_MAX_SIZE == 0) {
+		ztest_test_skip();
+	}
+
+#if CONFIG_WEAVE_VALUE_MAX_SIZE > 0
+	struct test_value msg = {.a = 0x12345678, .b = 0xBEEF, .c = 0x42};
+
+	memset(value_seen, 0, sizeof(value_seen));
+	k_msgq_purge(&value_queue);
+
+	int ret = WEAVE_VALUE_EMIT(&value_source, &msg, K_NO_WAIT);
+	zassert_equal(ret, 2, "Both sinks should receive a copy");
+
+	/* Sender may reuse its message right away */
+	msg.a = 0;
+
+	while (weave_process_messages(&value_queue, K_NO_WAIT) > 0) {
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(value_seen); i++) {
+		zassert_equal(atomic_get(&captures[i].count), 1, "Sink %zu called once", i);
+		zassert_not_equal(captures[i].last_ptr, &msg, "Sink %zu got a copy", i);
+		zassert_equal(value_seen[i].a, 0x12345678, "Sink %zu value intact", i);
+		zassert_equal(value_seen[i].b, 0xBEEF, "Sink %zu value intact", i);
+		zassert_equal(value_seen[i].c, 0x42, "Sink %zu value intact", i);
+	}
+	zassert_equal(atomic_get(&ref_count), 0, "No lifecycle callbacks");
+#endif
+}
+
+ZTEST(weave_core_unit_test, test_value_size_limits)
+{
+	uint8_t big[CONFIG_WEAVE_VALUE_MAX_SIZE + 1] = {0};
+
+	zassert_equal(weave_sink_send_value(&value_sinks[0], big, sizeof(big), K_NO_WAIT),
+		      -EMSGSIZE, "Oversized value should be rejected");
+	zassert_equal(weave_sink_send_value(&value_sinks[0], big, 0, K_NO_WAIT), -EINVAL,
+		      "Empty value should be rejected");
+	zassert_equal(weave_sink_send_value(NULL, big, 1, K_NO_WAIT), -EINVAL,
+		      "NULL sink should be rejected");
+	zassert_equal(atomic_get(&captures[0].count), 0, "Handler not called");
+}
+
+/* =============================================================================
+ * Demand-Driven Emit Tests
+ * =============================================================================
+ */
+
+/* Accepts a key only for sinks whose user_data matches it */
+static bool test_accepts(const void *key, const struct weave_sink *sink)
+{
+	return sink->user_data == key;
+}
+
+static const struct weave_payload_ops test_accept_ops = {
+	.accepts = test_accepts,
+	.ref = test_ref,
+	.unref = test_unref,
+};
+
+static atomic_t produce_count;
+static int produced_data;
+
+static int test_produce(void **ptr, void *user_data)
+{
+	atomic_inc(&produce_count);
+	*ptr = &produced_data;
+	return (int)(intptr_t)user_data;
+}
+
+ZTEST(weave_core_unit_test, test_would_deliver)
+{
+	zassert_false(weave_source_would_deliver(NULL, NULL), "NULL source");
+	zassert_false(weave_source_would_deliver(&sources[ISOLATED], NULL), "No sinks");
+	zassert_true(weave_source_would_deliver(&sources[0], NULL), "Connected source");
+
+	struct weave_source source = WEAVE_SOURCE_INITIALIZER(accept_src, &test_accept_ops);
+	struct weave_sink sink =
+		WEAVE_SINK_INITIALIZER(capture_handler, WV_IMMEDIATE, &captures[5]);
+	static struct weave_connection conn;
+
+	conn.source = &source;
+	conn.sink = &sink;
+	sys_slist_init(&source.sinks);
+	sys_slist_append(&source.sinks, &conn.node);
+
+	zassert_true(weave_source_would_deliver(&source, &captures[5]), "Matching key");
+	zassert_false(weave_source_would_deliver(&source, &captures[6]), "Non-matching key");
+	zassert_true(weave_source_would_deliver(&source, NULL), "NULL key matches any sink");
+}
+
+ZTEST(weave_core_unit_test, test_emit_lazy_skips_producer)
+{
+	atomic_clear(&produce_count);
+
+	int ret = weave_source_emit_lazy(&sources[ISOLATED], NULL, test_produce, NULL, K_NO_WAIT);
+
+	zassert_equal(ret, 0, "Nothing delivered");
+	zassert_equal(atomic_get(&produce_count), 0, "Producer not called without sinks");
+}
+
+ZTEST(weave_core_unit_test, test_emit_lazy_produces_and_releases)
+{
+	struct weave_source source = WEAVE_SOURCE_INITIALIZER(lazy_src, &test_ops);
+	static struct weave_connection conn;
+
+	conn.source = &source;
+	conn.sink = &sinks[2];
+	sys_slist_init(&source.sinks);
+	sys_slist_append(&source.sinks, &conn.node);
+	atomic_clear(&produce_count);
+
+	int ret = weave_source_emit_lazy(&source, NULL, test_produce, NULL, K_NO_WAIT);
+
+	zassert_equal(ret, 1, "Immediate sink receives the payload");
+	zassert_equal(atomic_get(&produce_count), 1, "Producer called once");
+	zassert_equal(captures[2].last_ptr, &produced_data, "Produced payload delivered");
+	zassert_equal(atomic_get(&ref_count), 1, "Sink reference taken");
+	zassert_equal(atomic_get(&unref_count), 2, "Sink and producer references released");
+
+	/* Producer errors abort the emit */
+	ret = weave_source_emit_lazy(&source, NULL, test_produce, (void *)-ENOMEM, K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "Producer error returned");
+	zassert_equal(atomic_get(&captures[2].count), 1, "No delivery after producer error");
+
+	zassert_equal(weave_source_emit_lazy(&source, NULL, NULL, NULL, K_NO_WAIT), -EINVAL,
+		      "NULL producer");
+}
+
 /* =============================================================================
  * Direct Sink Send Tests
  * =============================================================================
@@ -839,6 +1532,421 @@ ZTEST(weave_core_unit_test, test_connection_null_sink)
 	conn->sink = original;
 }
 
+/* =============================================================================
+ * Flow Control Tests
+ * =============================================================================
+ */
+
+#ifdef CONFIG_WEAVE_FLOW_CONTROL
+#define TEST_FLOW_CREDITS 2
+
+WEAVE_FLOW_SINK_DEFINE(flow_sink, capture_handler, &flow_queue, TEST_FLOW_CREDITS, &captures[8]);
+WEAVE_SINK_DEFINE(flow_peer_sink, capture_handler, WV_IMMEDIATE, &captures[9]);
+
+WEAVE_SOURCE_DEFINE(flow_source, &test_ops);
+WEAVE_CONNECT(&flow_source, &flow_sink);
+WEAVE_CONNECT(&flow_source, &flow_peer_sink);
+
+static void flow_reset(void)
+{
+	k_msgq_purge(&flow_queue);
+	weave_sink_credits_reset(&flow_sink);
+}
+
+ZTEST(weave_core_unit_test, test_flow_credits_bound_queued_events)
+{
+	int test_data = 0xF10;
+
+	flow_reset();
+	zassert_equal(weave_sink_credits(&flow_sink), TEST_FLOW_CREDITS, "Full credits");
+	zassert_equal(weave_sink_credits(&sinks[0]), INT_MAX, "Plain sink is unlimited");
+
+	for (int i = 0; i < TEST_FLOW_CREDITS; i++) {
+		zassert_ok(weave_sink_send(&flow_sink, &test_data, &test_ops, K_NO_WAIT));
+	}
+	zassert_equal(weave_sink_credits(&flow_sink), 0, "Credits used up");
+
+	/* Queue has room, but the sink granted no more credits */
+	zassert_equal(weave_sink_send(&flow_sink, &test_data, &test_ops, K_NO_WAIT), -ENOBUFS,
+		      "Send without credit should fail");
+	zassert_equal(k_msgq_num_used_get(&flow_queue), TEST_FLOW_CREDITS, "Queue bounded");
+	zassert_equal(atomic_get(&ref_count), atomic_get(&unref_count) + TEST_FLOW_CREDITS,
+		      "Dropped payload released");
+
+	zassert_equal(weave_process_messages(&flow_queue, K_NO_WAIT), TEST_FLOW_CREDITS,
+		      "Queued events handled");
+	zassert_equal(weave_sink_credits(&flow_sink), TEST_FLOW_CREDITS, "Credits returned");
+}
+
+ZTEST(weave_core_unit_test, test_flow_source_credits)
+{
+	int test_data = 0xF10;
+
+	flow_reset();
+	zassert_equal(weave_source_credits(&flow_source), TEST_FLOW_CREDITS, "Slowest sink");
+	zassert_equal(weave_source_credits(&sources[0]), INT_MAX, "No flow-controlled sinks");
+
+	for (int i = 0; i < TEST_FLOW_CREDITS; i++) {
+		zassert_equal(weave_source_emit(&flow_source, &test_data, K_NO_WAIT), 2,
+			      "Both sinks receive");
+	}
+	zassert_equal(weave_source_credits(&flow_source), 0, "Producer can see the overload");
+
+	/* Emitting anyway only reaches the sink that is not flow-controlled */
+	zassert_equal(weave_source_emit(&flow_source, &test_data, K_NO_WAIT), 1,
+		      "Flow-controlled sink drops");
+	zassert_equal(atomic_get(&captures[9].count), TEST_FLOW_CREDITS + 1,
+		      "Peer sink unaffected");
+
+	weave_process_messages(&flow_queue, K_NO_WAIT);
+	zassert_equal(weave_source_credits(&flow_source), TEST_FLOW_CREDITS, "Credits back");
+}
+
+ZTEST(weave_core_unit_test, test_flow_wait_credits)
+{
+	int test_data = 0xF10;
+
+	flow_reset();
+	zassert_ok(weave_source_wait_credits(&flow_source, K_NO_WAIT), "Credits available");
+
+	for (int i = 0; i < TEST_FLOW_CREDITS; i++) {
+		weave_source_emit(&flow_source, &test_data, K_NO_WAIT);
+	}
+
+	zassert_equal(weave_source_wait_credits(&flow_source, K_MSEC(5)), -EAGAIN,
+		      "Wait times out while exhausted");
+
+	/* A single returned credit ends the wait */
+	zassert_equal(weave_process_messages(&flow_queue, K_NO_WAIT), TEST_FLOW_CREDITS,
+		      "Consumer catches up");
+	zassert_ok(weave_source_wait_credits(&flow_source, K_NO_WAIT), "Credits returned");
+	zassert_equal(weave_source_wait_credits(NULL, K_NO_WAIT), -EINVAL, "NULL source");
+}
+
+ZTEST(weave_core_unit_test, test_flow_credits_reset_after_purge)
+{
+	int test_data = 0xF10;
+
+	flow_reset();
+	zassert_ok(weave_sink_send(&flow_sink, &test_data, NULL, K_NO_WAIT));
+	k_msgq_purge(&flow_queue);
+	zassert_equal(weave_sink_credits(&flow_sink), TEST_FLOW_CREDITS - 1,
+		      "Purge does not return credits");
+
+	weave_sink_credits_reset(&flow_sink);
+	zassert_equal(weave_sink_credits(&flow_sink), TEST_FLOW_CREDITS, "Reset restores credits");
+}
+
+ZTEST(weave_core_unit_test, test_flow_credits_reset_with_events_queued)
+{
+	int test_data = 0xF10;
+
+	flow_reset();
+	zassert_ok(weave_sink_send(&flow_sink, &test_data, &test_ops, K_NO_WAIT));
+
+	/* Reset while the event is still queued - freeing it must not add a credit */
+	weave_sink_credits_reset(&flow_sink);
+	zassert_equal(weave_process_messages(&flow_queue, K_NO_WAIT), 1, "Event handled");
+	zassert_equal(weave_sink_credits(&flow_sink), TEST_FLOW_CREDITS, "Bounded by the limit");
+}
+#endif /* CONFIG_WEAVE_FLOW_CONTROL */
+
+/* =============================================================================
+ * Wake Moderation Tests
+ * =============================================================================
+ */
+
+#ifdef CONFIG_WEAVE_WAKE_MODERATION
+#define TEST_MOD_EVENTS   4
+#define TEST_MOD_DELAY_US 2000
+
+WEAVE_MODERATED_MSGQ_DEFINE(mod_queue, 8, TEST_MOD_EVENTS, TEST_MOD_DELAY_US);
+
+WEAVE_SINK_DEFINE(mod_sink, capture_handler, &mod_queue, &captures[8]);
+
+/* Never connected - its moderation is looked up on the first send */
+WEAVE_SINK_DEFINE(mod_direct_sink, capture_handler, &mod_queue, &captures[8]);
+
+WEAVE_SOURCE_DEFINE(mod_source, &test_ops);
+WEAVE_CONNECT(&mod_source, &mod_sink);
+
+static void mod_reset(void)
+{
+	k_timer_stop(&mod_queue_moderation.timer);
+	k_msgq_purge(&mod_queue);
+	atomic_clear(&mod_queue_moderation.pending);
+	k_sem_reset(&mod_queue_moderation.wake);
+}
+
+ZTEST(weave_core_unit_test, test_moderation_wakes_after_n_events)
+{
+	static int test_data[TEST_MOD_EVENTS];
+
+	mod_reset();
+
+	for (int i = 0; i < TEST_MOD_EVENTS - 1; i++) {
+		zassert_equal(weave_source_emit(&mod_source, &test_data[i], K_NO_WAIT), 1,
+			      "Emit %d should succeed", i);
+	}
+	zassert_equal(weave_process_moderated(&mod_queue_moderation, K_NO_WAIT), 0,
+		      "Consumer not woken below threshold");
+	zassert_equal(k_msgq_num_used_get(&mod_queue), TEST_MOD_EVENTS - 1, "Events pending");
+
+	weave_source_emit(&mod_source, &test_data[TEST_MOD_EVENTS - 1], K_NO_WAIT);
+	zassert_equal(weave_process_moderated(&mod_queue_moderation, K_NO_WAIT), TEST_MOD_EVENTS,
+		      "Whole batch handled in one wake-up");
+	zassert_equal(atomic_get(&captures[8].count), TEST_MOD_EVENTS, "Every event handled");
+	zassert_equal(atomic_get(&mod_queue_moderation.pending), 0, "Window restarted");
+}
+
+ZTEST(weave_core_unit_test, test_moderation_wakes_after_delay)
+{
+	int test_data = 0x111;
+
+	mod_reset();
+
+	weave_source_emit(&mod_source, &test_data, K_NO_WAIT);
+	zassert_equal(weave_process_moderated(&mod_queue_moderation, K_NO_WAIT), 0,
+		      "Not woken right away");
+
+	/* The first pending event bounds the latency */
+	zassert_equal(weave_process_moderated(&mod_queue_moderation, K_MSEC(100)), 1,
+		      "Woken by the delay timer");
+	zassert_equal(captures[8].last_ptr, &test_data, "Correct payload");
+}
+
+ZTEST(weave_core_unit_test, test_moderation_urgent_emit)
+{
+	int test_data = 0x111;
+
+	mod_reset();
+
+	zassert_equal(weave_source_emit_urgent(&mod_source, &test_data, K_NO_WAIT), 1,
+		      "Urgent emit delivers");
+	zassert_equal(weave_process_moderated(&mod_queue_moderation, K_NO_WAIT), 1,
+		      "Consumer woken immediately");
+	zassert_equal(weave_process_moderated(NULL, K_NO_WAIT), -EINVAL, "NULL moderation");
+}
+
+ZTEST(weave_core_unit_test, test_moderation_direct_send)
+{
+	static int test_data[TEST_MOD_EVENTS];
+
+	mod_reset();
+
+	for (int i = 0; i < TEST_MOD_EVENTS; i++) {
+		zassert_ok(weave_sink_send(&mod_direct_sink, &test_data[i], &test_ops, K_NO_WAIT),
+			   "Send %d should succeed", i);
+	}
+
+	zassert_equal(atomic_get(&mod_queue_moderation.pending), TEST_MOD_EVENTS,
+		      "Sends counted by the queue's moderation");
+	zassert_equal(weave_process_moderated(&mod_queue_moderation, K_NO_WAIT), TEST_MOD_EVENTS,
+		      "Consumer woken by the threshold");
+}
+#endif /* CONFIG_WEAVE_WAKE_MODERATION */
+
+/* =============================================================================
+ * Work Sink Tests
+ * =============================================================================
+ */
+
+#ifdef CONFIG_WEAVE_WORK_SINK
+WEAVE_WORK_SINK_DEFINE(work_sink, capture_handler, WV_SYSTEM_WORKQ, 4, &captures[8]);
+
+K_THREAD_STACK_DEFINE(test_work_q_stack, 1024);
+static struct k_work_q test_work_q;
+
+WEAVE_WORK_SINK_DEFINE(work_sink_own_q, capture_handler, &test_work_q, 4, &captures[9]);
+
+WEAVE_SOURCE_DEFINE(work_source, &test_ops);
+WEAVE_CONNECT(&work_source, &work_sink);
+WEAVE_CONNECT(&work_source, &work_sink_own_q);
+
+ZTEST(weave_core_unit_test, test_work_sink_runs_on_system_workq)
+{
+	static int test_data[3];
+
+	ARRAY_FOR_EACH(test_data, i) {
+		zassert_ok(weave_sink_send(&work_sink, &test_data[i], &test_ops, K_NO_WAIT));
+	}
+
+	/* Handled by the system work queue, not by the sender */
+	k_sleep(K_MSEC(10));
+	zassert_equal(atomic_get(&captures[8].count), ARRAY_SIZE(test_data), "All handled");
+	zassert_equal(captures[8].last_ptr, &test_data[ARRAY_SIZE(test_data) - 1],
+		      "Handled in order");
+	zassert_equal(k_msgq_num_used_get(&work_sink_msgq), 0, "Private queue drained");
+	zassert_equal(atomic_get(&unref_count), ARRAY_SIZE(test_data), "All refs released");
+}
+
+ZTEST(weave_core_unit_test, test_work_sink_fanout_to_own_workq)
+{
+	int test_data = 0x112;
+
+	k_work_queue_start(&test_work_q, test_work_q_stack,
+			   K_THREAD_STACK_SIZEOF(test_work_q_stack), K_PRIO_PREEMPT(1), NULL);
+
+	zassert_equal(weave_source_emit(&work_source, &test_data, K_NO_WAIT), 2,
+		      "Both work sinks receive");
+
+	k_sleep(K_MSEC(10));
+	zassert_equal(atomic_get(&captures[8].count), 1, "System work queue sink handled");
+	zassert_equal(atomic_get(&captures[9].count), 1, "Own work queue sink handled");
+	zassert_equal(captures[9].last_ptr, &test_data, "Correct payload");
+	zassert_equal(atomic_get(&ref_count), atomic_get(&unref_count), "Refs balanced");
+}
+#endif /* CONFIG_WEAVE_WORK_SINK */
+
+/* =============================================================================
+ * Runtime Wiring Tests
+ * =============================================================================
+ */
+
+#ifdef CONFIG_WEAVE_RUNTIME_CONNECT
+ZTEST(weave_core_unit_test, test_runtime_connect_disconnect)
+{
+	struct weave_connection conn = {0};
+	int test_data = 0x108;
+
+	zassert_ok(weave_connect(&conn, &sources[ISOLATED], &sinks[2]), "Connect should succeed");
+	zassert_equal(weave_connect(&conn, &sources[ISOLATED], &sinks[2]), -EALREADY,
+		      "Double connect should fail");
+
+	int ret = weave_source_emit(&sources[ISOLATED], &test_data, K_NO_WAIT);
+
+	zassert_equal(ret, 1, "Runtime sink should receive");
+	zassert_equal(captures[2].last_ptr, &test_data, "Correct payload");
+
+	zassert_ok(weave_disconnect(&conn), "Disconnect should succeed");
+	zassert_equal(weave_disconnect(&conn), -EINVAL, "Already disconnected");
+
+	ret = weave_source_emit(&sources[ISOLATED], &test_data, K_NO_WAIT);
+	zassert_equal(ret, 0, "No sinks after disconnect");
+	zassert_equal(atomic_get(&captures[2].count), 1, "Handler not called again");
+
+	/* Connection storage is reusable after disconnect */
+	zassert_ok(weave_connect(&conn, &sources[ISOLATED], &sinks[2]), "Reconnect");
+	zassert_ok(weave_disconnect(&conn), "Disconnect again");
+}
+
+ZTEST(weave_core_unit_test, test_runtime_disconnect_middle)
+{
+	struct weave_connection conns[3] = {0};
+	int test_data = 0x108;
+
+	ARRAY_FOR_EACH(conns, i) {
+		zassert_ok(weave_connect(&conns[i], &sources[ISOLATED], &sinks[i]), "Connect %zu",
+			   i);
+	}
+
+	/* Unlink the middle node, then the tail, then the head */
+	zassert_ok(weave_disconnect(&conns[1]), "Disconnect middle");
+	zassert_equal(weave_source_emit(&sources[ISOLATED], &test_data, K_NO_WAIT), 2,
+		      "Head and tail remain");
+	zassert_ok(weave_disconnect(&conns[2]), "Disconnect tail");
+	zassert_ok(weave_connect(&conns[1], &sources[ISOLATED], &sinks[1]), "Append after tail");
+	zassert_equal(weave_source_emit(&sources[ISOLATED], &test_data, K_NO_WAIT), 2,
+		      "Tail pointer was fixed up");
+	zassert_ok(weave_disconnect(&conns[0]), "Disconnect head");
+	zassert_ok(weave_disconnect(&conns[1]), "Disconnect last");
+
+	process_all_messages();
+}
+
+ZTEST(weave_core_unit_test, test_runtime_connect_invalid)
+{
+	struct weave_connection conn = {0};
+
+	zassert_equal(weave_connect(NULL, &sources[0], &sinks[0]), -EINVAL, "NULL conn");
+	zassert_equal(weave_connect(&conn, NULL, &sinks[0]), -EINVAL, "NULL source");
+	zassert_equal(weave_connect(&conn, &sources[0], NULL), -EINVAL, "NULL sink");
+	zassert_equal(weave_disconnect(NULL), -EINVAL, "NULL conn");
+
+	/* Claims to be connected but is not linked */
+	conn.source = &sources[ISOLATED];
+	conn.sink = &sinks[2];
+	zassert_equal(weave_disconnect(&conn), -ENOENT, "Unlinked conn");
+}
+
+#ifdef CONFIG_THREAD_LOCAL_STORAGE
+static struct weave_connection self_conn;
+static int self_disconnect_ret;
+
+static void self_disconnect_handler(void *ptr, void *user_data)
+{
+	ARG_UNUSED(ptr);
+	ARG_UNUSED(user_data);
+
+	self_disconnect_ret = weave_disconnect(&self_conn);
+}
+
+WEAVE_SINK_DEFINE(self_disconnect_sink, self_disconnect_handler, WV_IMMEDIATE, NULL);
+
+ZTEST(weave_core_unit_test, test_runtime_disconnect_from_handler)
+{
+	int test_data = 0x108;
+
+	zassert_ok(weave_connect(&self_conn, &sources[ISOLATED], &self_disconnect_sink),
+		   "Connect");
+
+	self_disconnect_ret = 0;
+	zassert_equal(weave_source_emit(&sources[ISOLATED], &test_data, K_NO_WAIT), 1,
+		      "Handler should run");
+	zassert_equal(self_disconnect_ret, -EDEADLK, "Disconnect inside the emit must fail");
+
+	/* Outside the emit the same call goes through */
+	zassert_ok(weave_disconnect(&self_conn), "Disconnect after the emit");
+}
+#endif /* CONFIG_THREAD_LOCAL_STORAGE */
+
+#define EMITTER_STACK_SIZE 1024
+
+K_THREAD_STACK_DEFINE(emitter_stack, EMITTER_STACK_SIZE);
+static struct k_thread emitter_thread;
+static atomic_t emitter_stop;
+
+static void emitter_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	int test_data = 0x108;
+
+	while (!atomic_get(&emitter_stop)) {
+		weave_source_emit(&sources[ISOLATED], &test_data, K_NO_WAIT);
+		k_yield();
+	}
+}
+
+ZTEST(weave_core_unit_test, test_runtime_rewire_during_emit)
+{
+	struct weave_connection conn = {0};
+
+	atomic_clear(&emitter_stop);
+	k_thread_create(&emitter_thread, emitter_stack, K_THREAD_STACK_SIZEOF(emitter_stack),
+			emitter_entry, NULL, NULL, NULL, K_PRIO_PREEMPT(1), 0, K_NO_WAIT);
+
+	for (int i = 0; i < 20; i++) {
+		zassert_ok(weave_connect(&conn, &sources[ISOLATED], &sinks[2]), "Connect %d", i);
+		k_yield();
+		zassert_ok(weave_disconnect(&conn), "Disconnect %d", i);
+
+		/* Grace period over: no emit may still see the connection */
+		atomic_val_t count = atomic_get(&captures[2].count);
+
+		k_yield();
+		zassert_equal(atomic_get(&captures[2].count), count, "Delivery after disconnect");
+	}
+
+	atomic_set(&emitter_stop, 1);
+	k_thread_join(&emitter_thread, K_FOREVER);
+
+	zassert_equal(atomic_get(&ref_count), atomic_get(&unref_count), "Refs balanced");
+}
+#endif /* CONFIG_WEAVE_RUNTIME_CONNECT */
+
 /* =============================================================================
  * Stress Tests
  * =============================================================================
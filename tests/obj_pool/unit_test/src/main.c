@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+#include <weave/obj_pool.h>
+
+/* Test configuration constants */
+#define TEST_POOL_SIZE  4
+#define TEST_QUEUE_SIZE 4
+
+/* =============================================================================
+ * Test Object Types
+ * =============================================================================
+ */
+
+struct test_msg {
+	int16_t temperature;
+	uint16_t humidity;
+	uint32_t sequence;
+	uint32_t timestamp;
+};
+
+/* Type with stricter alignment than the refcount header */
+struct test_wide_msg {
+	uint64_t value;
+	uint8_t tag;
+};
+
+WEAVE_OBJ_POOL_DEFINE(test_pool, struct test_msg, TEST_POOL_SIZE);
+WEAVE_OBJ_POOL_DEFINE(wide_pool, struct test_wide_msg, 2);
+
+WEAVE_MSGQ_DEFINE(test_queue, TEST_QUEUE_SIZE);
+
+/* =============================================================================
+ * Test Capture Context
+ * =============================================================================
+ */
+
+struct obj_capture {
+	atomic_t count;
+	struct test_msg *last_msg;
+	atomic_val_t last_refcount;
+};
+
+static struct obj_capture captures[3] = {0};
+
+static void reset_all_captures(void)
+{
+	ARRAY_FOR_EACH_PTR(captures, capture) {
+		atomic_clear(&capture->count);
+		capture->last_msg = NULL;
+		capture->last_refcount = 0;
+	}
+}
+
+static void obj_capture_handler(void *ptr, void *user_data)
+{
+	struct obj_capture *capture = (struct obj_capture *)user_data;
+
+	zassert_not_null(ptr, "Object should not be NULL");
+
+	atomic_inc(&capture->count);
+	capture->last_msg = (struct test_msg *)ptr;
+	capture->last_refcount = weave_obj_refcount(ptr);
+}
+
+/* =============================================================================
+ * Sources, Sinks, Connections
+ * =============================================================================
+ */
+
+/* Fan-out source: one immediate and two queued sinks */
+WEAVE_OBJ_SOURCE_DEFINE(test_source, test_pool);
+
+WEAVE_SINK_DEFINE(sink_immediate, obj_capture_handler, WV_IMMEDIATE, &captures[0]);
+WEAVE_SINK_DEFINE(sink_queued_a, obj_capture_handler, &test_queue, &captures[1]);
+WEAVE_SINK_DEFINE(sink_queued_b, obj_capture_handler, &test_queue, &captures[2]);
+
+WEAVE_CONNECT(&test_source, &sink_immediate);
+WEAVE_CONNECT(&test_source, &sink_queued_a);
+WEAVE_CONNECT(&test_source, &sink_queued_b);
+
+/* =============================================================================
+ * Test Setup/Teardown
+ * =============================================================================
+ */
+
+static void process_all_messages(void)
+{
+	while (weave_process_messages(&test_queue, K_NO_WAIT) > 0) {
+	}
+}
+
+static void test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	reset_all_captures();
+	k_msgq_purge(&test_queue);
+}
+
+static void test_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	process_all_messages();
+
+	/* Verify no object leaks */
+	zassert_equal(k_mem_slab_num_used_get(&test_pool_slab), 0, "All objects should be freed");
+	zassert_equal(k_mem_slab_num_used_get(&wide_pool_slab), 0, "All objects should be freed");
+}
+
+ZTEST_SUITE(weave_obj_pool_unit_test, NULL, NULL, test_setup, test_teardown, NULL);
+
+/* =============================================================================
+ * Allocation Tests
+ * =============================================================================
+ */
+
+ZTEST(weave_obj_pool_unit_test, test_alloc_basic)
+{
+	struct test_msg *msg = weave_obj_alloc(&test_pool, K_NO_WAIT);
+
+	zassert_not_null(msg, "Alloc should succeed");
+	zassert_equal(weave_obj_refcount(msg), 1, "Caller owns one reference");
+	zassert_equal(k_mem_slab_num_used_get(&test_pool_slab), 1, "One block in use");
+
+	weave_obj_unref(&test_pool, msg);
+	zassert_equal(k_mem_slab_num_used_get(&test_pool_slab), 0, "Block freed on last unref");
+}
+
+ZTEST(weave_obj_pool_unit_test, test_alloc_null_pool)
+{
+	zassert_is_null(weave_obj_alloc(NULL, K_NO_WAIT), "NULL pool should fail");
+
+	/* Must not crash */
+	weave_obj_unref(NULL, NULL);
+	weave_obj_unref(&test_pool, NULL);
+}
+
+ZTEST(weave_obj_pool_unit_test, test_alloc_exhaustion)
+{
+	struct test_msg *msgs[TEST_POOL_SIZE];
+
+	ARRAY_FOR_EACH(msgs, i) {
+		msgs[i] = weave_obj_alloc(&test_pool, K_NO_WAIT);
+		zassert_not_null(msgs[i], "Alloc %zu should succeed", i);
+	}
+
+	zassert_is_null(weave_obj_alloc(&test_pool, K_NO_WAIT), "Exhausted pool should fail");
+
+	ARRAY_FOR_EACH(msgs, i) {
+		weave_obj_unref(&test_pool, msgs[i]);
+	}
+}
+
+ZTEST(weave_obj_pool_unit_test, test_alignment)
+{
+	struct test_wide_msg *msg = weave_obj_alloc(&wide_pool, K_NO_WAIT);
+
+	zassert_not_null(msg, "Alloc should succeed");
+	zassert_true(IS_ALIGNED(msg, __alignof__(struct test_wide_msg)),
+		     "Object should be aligned for its type");
+
+	msg->value = UINT64_MAX;
+	msg->tag = 0xA5;
+	zassert_equal(weave_obj_refcount(msg), 1, "Object writes must not touch the header");
+
+	weave_obj_unref(&wide_pool, msg);
+}
+
+ZTEST(weave_obj_pool_unit_test, test_ref_unref)
+{
+	struct test_msg *msg = weave_obj_alloc(&test_pool, K_NO_WAIT);
+
+	zassert_equal_ptr(weave_obj_ref(msg), msg, "Ref returns the object");
+	zassert_equal(weave_obj_refcount(msg), 2, "Two references");
+
+	weave_obj_unref(&test_pool, msg);
+	zassert_equal(k_mem_slab_num_used_get(&test_pool_slab), 1, "Still held");
+
+	weave_obj_unref(&test_pool, msg);
+	zassert_equal(k_mem_slab_num_used_get(&test_pool_slab), 0, "Freed");
+}
+
+/* =============================================================================
+ * Fan-out Tests
+ * =============================================================================
+ */
+
+ZTEST(weave_obj_pool_unit_test, test_send_fanout)
+{
+	struct test_msg *msg = weave_obj_alloc(&test_pool, K_NO_WAIT);
+
+	msg->temperature = 2350;
+	msg->sequence = 7;
+
+	int ret = weave_obj_send(&test_source, msg, K_NO_WAIT);
+
+	zassert_equal(ret, 3, "All three sinks should receive the object");
+	zassert_equal(atomic_get(&captures[0].count), 1, "Immediate sink called");
+	zassert_equal(captures[0].last_refcount, 2, "Sender and immediate sink hold refs");
+	zassert_equal(k_mem_slab_num_used_get(&test_pool_slab), 1, "Queued sinks keep it alive");
+
+	process_all_messages();
+
+	for (size_t i = 1; i < ARRAY_SIZE(captures); i++) {
+		zassert_equal(atomic_get(&captures[i].count), 1, "Queued sink %zu called", i);
+		zassert_equal_ptr(captures[i].last_msg, msg, "Zero-copy delivery");
+	}
+	zassert_equal(captures[1].last_msg->sequence, 7, "Payload visible to sinks");
+
+	/* Teardown verifies the block returned to the slab */
+}
+
+ZTEST(weave_obj_pool_unit_test, test_send_queue_full_releases)
+{
+	struct test_msg *msg;
+	int ret;
+
+	/* Each send takes two queue slots (two queued sinks) */
+	for (int i = 0; i < TEST_QUEUE_SIZE / 2; i++) {
+		msg = weave_obj_alloc(&test_pool, K_NO_WAIT);
+		ret = weave_obj_send(&test_source, msg, K_NO_WAIT);
+		zassert_equal(ret, 3, "Send %d should reach all sinks", i);
+	}
+
+	/* Queue full - only the immediate sink gets it, queued refs are dropped */
+	msg = weave_obj_alloc(&test_pool, K_NO_WAIT);
+	ret = weave_obj_send(&test_source, msg, K_NO_WAIT);
+	zassert_equal(ret, 1, "Only the immediate sink should receive");
+	zassert_equal(k_mem_slab_num_used_get(&test_pool_slab), TEST_QUEUE_SIZE / 2,
+		      "Undelivered object freed right away");
+
+	process_all_messages();
+
+	/* Teardown verifies every block returned to the slab */
+}
+
+ZTEST(weave_obj_pool_unit_test, test_send_invalid)
+{
+	int dummy;
+	struct weave_source no_ops = WEAVE_SOURCE_INITIALIZER(no_ops, WV_NO_OPS);
+
+	zassert_equal(weave_obj_send(NULL, &dummy, K_NO_WAIT), -EINVAL, "NULL source");
+	zassert_equal(weave_obj_send(&test_source, NULL, K_NO_WAIT), -EINVAL, "NULL object");
+	zassert_equal(weave_obj_send(&no_ops, &dummy, K_NO_WAIT), -EINVAL, "Source without ops");
+}
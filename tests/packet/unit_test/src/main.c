@@ -549,6 +549,133 @@ ZTEST(weave_packet_unit_test, test_filter_multiple_packets)
 	zassert_equal(atomic_get(&captures[3].count), 1, "sink_status should receive 1");
 }
 
+/* =============================================================================
+ * Batch Sink Tests
+ * =============================================================================
+ */
+
+#define TEST_BATCH_MAX 4
+
+static size_t batch_calls;
+static size_t batch_items;
+
+static void packet_batch_handler(struct net_buf *const *bufs, size_t count, void *user_data)
+{
+	zassert_equal(user_data, &batch_calls, "User data should be passed through");
+
+	for (size_t i = 0; i < count; i++) {
+		uint8_t id;
+
+		zassert_ok(weave_packet_get_id(bufs[i], &id), "Get ID should succeed");
+		zassert_equal(id, TEST_ID_SENSOR, "Only sensor packets should pass the filter");
+	}
+
+	batch_calls++;
+	batch_items += count;
+}
+
+WEAVE_PACKET_SOURCE_DEFINE(batch_source);
+WEAVE_PACKET_BATCH_SINK_DEFINE(sink_batch, packet_batch_handler, &test_queue, TEST_BATCH_MAX,
+			       TEST_ID_SENSOR, &batch_calls);
+WEAVE_BATCH_CONNECT(&batch_source, sink_batch);
+
+ZTEST(weave_packet_unit_test, test_batch_sink_filters_and_batches)
+{
+	struct net_buf *buf;
+
+	batch_calls = 0;
+	batch_items = 0;
+
+	for (int i = 0; i < 3; i++) {
+		buf = weave_packet_alloc_with_id(&test_pool, TEST_ID_SENSOR, K_NO_WAIT);
+		zassert_equal(weave_packet_send(&batch_source, buf, K_NO_WAIT), 1,
+			      "Sensor packet should be queued");
+
+		buf = weave_packet_alloc_with_id(&test_pool, TEST_ID_CONTROL, K_NO_WAIT);
+		zassert_equal(weave_packet_send(&batch_source, buf, K_NO_WAIT), 0,
+			      "Control packet should be filtered");
+	}
+
+	process_all_messages();
+
+	zassert_equal(batch_items, 3, "All sensor packets delivered");
+	zassert_true(batch_calls >= 1 && batch_calls <= 3, "Packets delivered in batches");
+
+	/* Teardown verifies every buffer was released */
+}
+
+/* =============================================================================
+ * Lazy Send Tests
+ * =============================================================================
+ */
+
+/* Source whose only sink accepts sensor packets */
+WEAVE_PACKET_SOURCE_DEFINE(lazy_source);
+WEAVE_CONNECT(&lazy_source, &sink_filter_sensor);
+
+/* Source with no sinks at all */
+WEAVE_PACKET_SOURCE_DEFINE(unconnected_source);
+
+static int lazy_fill_count;
+
+static int lazy_fill(struct net_buf *buf, void *user_data)
+{
+	lazy_fill_count++;
+	net_buf_add_u8(buf, 0x5A);
+	return (int)(intptr_t)user_data;
+}
+
+ZTEST(weave_packet_unit_test, test_would_deliver_by_id)
+{
+	zassert_true(weave_packet_would_deliver(&lazy_source, TEST_ID_SENSOR), "Sensor accepted");
+	zassert_false(weave_packet_would_deliver(&lazy_source, TEST_ID_CONTROL),
+		      "Control filtered by every sink");
+	zassert_true(weave_packet_would_deliver(&lazy_source, WEAVE_PACKET_ID_ANY),
+		     "ID_ANY passes all filters");
+	zassert_true(weave_packet_would_deliver(&filtered_source, TEST_ID_CONTROL),
+		     "Accepted by the matching and the unfiltered sink");
+	zassert_false(weave_packet_would_deliver(&unconnected_source, TEST_ID_SENSOR),
+		      "Nobody connected");
+}
+
+ZTEST(weave_packet_unit_test, test_send_lazy_skips_alloc)
+{
+	size_t free_before = pool_num_free(test_pool.pool);
+
+	lazy_fill_count = 0;
+
+	int ret = weave_packet_send_lazy(&lazy_source, &test_pool, TEST_ID_CONTROL, lazy_fill,
+					 NULL, K_NO_WAIT);
+	zassert_equal(ret, 0, "Nothing delivered");
+
+	ret = weave_packet_send_lazy(&unconnected_source, &test_pool, TEST_ID_SENSOR, lazy_fill,
+				     NULL, K_NO_WAIT);
+	zassert_equal(ret, 0, "Nothing delivered");
+
+	zassert_equal(lazy_fill_count, 0, "Fill never called");
+	zassert_equal(pool_num_free(test_pool.pool), free_before, "No buffer allocated");
+}
+
+ZTEST(weave_packet_unit_test, test_send_lazy_delivers)
+{
+	lazy_fill_count = 0;
+
+	int ret = weave_packet_send_lazy(&lazy_source, &test_pool, TEST_ID_SENSOR, lazy_fill,
+					 NULL, K_NO_WAIT);
+
+	zassert_equal(ret, 1, "Sensor sink receives the packet");
+	zassert_equal(lazy_fill_count, 1, "Fill called once");
+	zassert_equal(atomic_get(&captures[1].count), 1, "Sensor sink called");
+
+	/* Fill errors drop the packet */
+	ret = weave_packet_send_lazy(&lazy_source, &test_pool, TEST_ID_SENSOR, lazy_fill,
+				     (void *)-EIO, K_NO_WAIT);
+	zassert_equal(ret, -EIO, "Fill error returned");
+	zassert_equal(atomic_get(&captures[1].count), 1, "No delivery after fill error");
+
+	/* Teardown verifies the buffers were released */
+}
+
 /* =============================================================================
  * Send Function Tests
  * =============================================================================
@@ -970,3 +1097,411 @@ ZTEST(weave_packet_unit_test, test_alloc_from_pool_without_metadata_space)
 
 	net_buf_unref(buf);
 }
+
+/* =============================================================================
+ * External Data Tests
+ * =============================================================================
+ */
+
+#define TEST_REF_POOL_SIZE 2
+
+WEAVE_PACKET_REF_POOL_DEFINE(test_ref_pool, TEST_REF_POOL_SIZE);
+
+static const uint8_t ref_table[300] = {[0] = 0x5A, [299] = 0xA5};
+
+struct ref_release_capture {
+	int count;
+	const void *data;
+	struct net_buf *realloc_buf;
+};
+
+static void ref_release(const void *data, void *user_data)
+{
+	struct ref_release_capture *capture = user_data;
+
+	capture->count++;
+	capture->data = data;
+}
+
+/* Release callback that immediately reuses the freed buffer, as a DMA ring would */
+static void ref_release_realloc(const void *data, void *user_data)
+{
+	struct ref_release_capture *capture = user_data;
+
+	ref_release(data, user_data);
+	capture->realloc_buf = weave_packet_alloc_ref_data(&test_ref_pool, data, 1, NULL, NULL,
+							   K_NO_WAIT);
+}
+
+ZTEST(weave_packet_unit_test, test_ref_data_zero_copy)
+{
+	struct ref_release_capture release = {0};
+	uint16_t counter;
+	uint8_t packet_id;
+
+	struct net_buf *buf = weave_packet_alloc_ref_data(&test_ref_pool, ref_table,
+							  sizeof(ref_table), ref_release,
+							  &release, K_NO_WAIT);
+
+	zassert_not_null(buf, "Alloc should succeed");
+	zassert_equal_ptr(buf->data, ref_table, "Data is the table itself");
+	zassert_equal(buf->len, sizeof(ref_table), "Length set");
+	zassert_ok(weave_packet_get_id(buf, &packet_id), "Metadata initialized");
+	zassert_equal(packet_id, WEAVE_PACKET_ID_ANY);
+	zassert_ok(weave_packet_get_counter(buf, &counter));
+
+	/* Immediate and queued sink both hold it */
+	zassert_equal(weave_packet_send(&basic_source, buf, K_NO_WAIT), 2);
+	zassert_equal(captures[4].last_buf->data[299], 0xA5, "Sink reads the table");
+	zassert_equal(release.count, 0, "Queued sink still holds it");
+
+	process_all_messages();
+
+	zassert_equal(release.count, 1, "Released once on final unref");
+	zassert_equal_ptr(release.data, ref_table);
+	zassert_equal(pool_num_free(test_ref_pool.pool), TEST_REF_POOL_SIZE, "Buffer freed");
+}
+
+ZTEST(weave_packet_unit_test, test_ref_data_release_reallocates)
+{
+	struct ref_release_capture release = {0};
+	struct net_buf *bufs[TEST_REF_POOL_SIZE];
+
+	for (int i = 0; i < TEST_REF_POOL_SIZE; i++) {
+		bufs[i] = weave_packet_alloc_ref_data(&test_ref_pool, &ref_table[i], 1,
+						      ref_release_realloc, &release, K_NO_WAIT);
+		zassert_not_null(bufs[i], "Alloc should succeed");
+	}
+
+	zassert_is_null(weave_packet_alloc_ref_data(&test_ref_pool, ref_table, 1, NULL, NULL,
+						    K_NO_WAIT),
+			"Pool exhausted");
+
+	/* The freed buffer is available to the release callback */
+	net_buf_unref(bufs[0]);
+	zassert_equal(release.count, 1);
+	zassert_equal_ptr(release.data, &ref_table[0]);
+	zassert_not_null(release.realloc_buf, "Buffer returned before release");
+
+	/* Released without a callback */
+	net_buf_unref(release.realloc_buf);
+	zassert_equal(release.count, 1);
+
+	net_buf_unref(bufs[1]);
+	net_buf_unref(release.realloc_buf);
+	zassert_equal(release.count, 2);
+	zassert_equal(pool_num_free(test_ref_pool.pool), TEST_REF_POOL_SIZE, "Buffers freed");
+}
+
+ZTEST(weave_packet_unit_test, test_ref_data_invalid)
+{
+	zassert_is_null(weave_packet_alloc_ref_data(NULL, ref_table, 1, NULL, NULL, K_NO_WAIT));
+	zassert_is_null(weave_packet_alloc_ref_data(&test_pool, ref_table, 1, NULL, NULL,
+						    K_NO_WAIT),
+			"Not a reference pool");
+	zassert_is_null(weave_packet_alloc_ref_data(&test_ref_pool, NULL, 1, NULL, NULL,
+						    K_NO_WAIT));
+	zassert_is_null(weave_packet_alloc_ref_data(&test_ref_pool, ref_table, UINT16_MAX + 1,
+						    NULL, NULL, K_NO_WAIT),
+			"Longer than a net_buf");
+	zassert_is_null(weave_packet_alloc(&test_ref_pool, K_NO_WAIT),
+			"Reference pools have no data");
+	zassert_equal(pool_num_free(test_ref_pool.pool), TEST_REF_POOL_SIZE);
+}
+
+/* =============================================================================
+ * Pool Set Tests
+ * =============================================================================
+ */
+
+#define TEST_SET_SMALL_COUNT 2
+#define TEST_SET_SMALL_SIZE  16
+#define TEST_SET_LARGE_COUNT 1
+#define TEST_SET_LARGE_SIZE  64
+
+WEAVE_PACKET_POOL_SET_DEFINE(test_set, (TEST_SET_SMALL_COUNT, TEST_SET_SMALL_SIZE),
+			     (TEST_SET_LARGE_COUNT, TEST_SET_LARGE_SIZE));
+
+ZTEST(weave_packet_unit_test, test_pool_set_smallest_fit)
+{
+	struct net_buf *small = weave_packet_alloc_size(&test_set, TEST_SET_SMALL_SIZE, 0x01,
+							K_NO_WAIT);
+	struct net_buf *large = weave_packet_alloc_size(&test_set, TEST_SET_SMALL_SIZE + 1, 0x02,
+							K_NO_WAIT);
+	uint8_t packet_id;
+
+	zassert_not_null(small, "Alloc should succeed");
+	zassert_not_null(large, "Alloc should succeed");
+	zassert_equal(net_buf_tailroom(small), TEST_SET_SMALL_SIZE, "Smallest class that fits");
+	zassert_equal(net_buf_tailroom(large), TEST_SET_LARGE_SIZE, "Next class up");
+
+	zassert_ok(weave_packet_get_id(small, &packet_id), "Metadata initialized");
+	zassert_equal(packet_id, 0x01);
+	zassert_ok(weave_packet_get_id(large, &packet_id), "Metadata initialized");
+	zassert_equal(packet_id, 0x02);
+
+	zassert_is_null(weave_packet_alloc_size(&test_set, TEST_SET_LARGE_SIZE + 1, 0x01,
+						K_MSEC(10)),
+			"No class is large enough");
+	zassert_is_null(weave_packet_alloc_size(NULL, 1, 0x01, K_NO_WAIT));
+
+	net_buf_unref(small);
+	net_buf_unref(large);
+}
+
+ZTEST(weave_packet_unit_test, test_pool_set_fallback)
+{
+	struct net_buf *bufs[TEST_SET_SMALL_COUNT + TEST_SET_LARGE_COUNT];
+
+	for (int i = 0; i < ARRAY_SIZE(bufs); i++) {
+		bufs[i] = weave_packet_alloc_size(&test_set, 1, WEAVE_PACKET_ID_ANY, K_NO_WAIT);
+		zassert_not_null(bufs[i], "Alloc %d should succeed", i);
+	}
+
+	zassert_equal(net_buf_tailroom(bufs[TEST_SET_SMALL_COUNT]), TEST_SET_LARGE_SIZE,
+		      "Falls back to the larger class");
+	zassert_is_null(weave_packet_alloc_size(&test_set, 1, WEAVE_PACKET_ID_ANY, K_NO_WAIT),
+			"Set exhausted");
+
+	/* A freed small buffer is preferred again */
+	net_buf_unref(bufs[0]);
+	bufs[0] = weave_packet_alloc_size(&test_set, 1, WEAVE_PACKET_ID_ANY, K_NO_WAIT);
+	zassert_not_null(bufs[0]);
+	zassert_equal(net_buf_tailroom(bufs[0]), TEST_SET_SMALL_SIZE);
+
+	ARRAY_FOR_EACH(bufs, i) {
+		net_buf_unref(bufs[i]);
+	}
+}
+
+ZTEST(weave_packet_unit_test, test_pool_set_shared_counter)
+{
+	struct net_buf *small = weave_packet_alloc_size(&test_set, 1, WEAVE_PACKET_ID_ANY,
+							K_NO_WAIT);
+	struct net_buf *large = weave_packet_alloc_size(&test_set, TEST_SET_LARGE_SIZE,
+							WEAVE_PACKET_ID_ANY, K_NO_WAIT);
+	uint16_t small_counter, large_counter;
+
+	zassert_not_null(small);
+	zassert_not_null(large);
+	zassert_ok(weave_packet_get_counter(small, &small_counter));
+	zassert_ok(weave_packet_get_counter(large, &large_counter));
+	zassert_equal((uint16_t)(large_counter - small_counter), 1,
+		      "One sequence across classes");
+
+	net_buf_unref(small);
+	net_buf_unref(large);
+}
+
+/* =============================================================================
+ * Priority Reserve Tests
+ * =============================================================================
+ */
+
+#define TEST_RESERVE_POOL_SIZE 3
+#define TEST_RESERVED          1
+
+WEAVE_PACKET_RESERVE_POOL_DEFINE(test_reserve_pool, TEST_RESERVE_POOL_SIZE, TEST_BUF_SIZE,
+				 TEST_RESERVED);
+
+ZTEST(weave_packet_unit_test, test_reserve_normal_leaves_reserve)
+{
+	struct net_buf *normal[TEST_RESERVE_POOL_SIZE - TEST_RESERVED];
+	struct net_buf *high;
+
+	ARRAY_FOR_EACH(normal, i) {
+		normal[i] = weave_packet_alloc(&test_reserve_pool, K_NO_WAIT);
+		zassert_not_null(normal[i], "Alloc %d should succeed", i);
+	}
+
+	zassert_is_null(weave_packet_alloc(&test_reserve_pool, K_NO_WAIT), "Only reserve left");
+	zassert_is_null(weave_packet_alloc(&test_reserve_pool, K_MSEC(10)), "Only reserve left");
+
+	high = weave_packet_alloc_prio(&test_reserve_pool, 0x01, K_NO_WAIT);
+	zassert_not_null(high, "Reserve available to high priority");
+	zassert_is_null(weave_packet_alloc_prio(&test_reserve_pool, 0x01, K_NO_WAIT),
+			"Pool exhausted");
+
+	zassert_equal(weave_packet_pool_used(&test_reserve_pool, WEAVE_PACKET_PRIO_NORMAL),
+		      ARRAY_SIZE(normal));
+	zassert_equal(weave_packet_pool_used(&test_reserve_pool, WEAVE_PACKET_PRIO_HIGH), 1);
+
+	/* A released normal buffer is available to normal allocations again */
+	net_buf_unref(normal[0]);
+	normal[0] = weave_packet_alloc(&test_reserve_pool, K_NO_WAIT);
+	zassert_not_null(normal[0]);
+
+	ARRAY_FOR_EACH(normal, i) {
+		net_buf_unref(normal[i]);
+	}
+	net_buf_unref(high);
+
+	zassert_equal(weave_packet_pool_used(&test_reserve_pool, WEAVE_PACKET_PRIO_NORMAL), 0);
+	zassert_equal(weave_packet_pool_used(&test_reserve_pool, WEAVE_PACKET_PRIO_HIGH), 0);
+	zassert_equal(pool_num_free(test_reserve_pool.pool), TEST_RESERVE_POOL_SIZE);
+}
+
+ZTEST(weave_packet_unit_test, test_reserve_high_takes_any)
+{
+	struct net_buf *high[TEST_RESERVE_POOL_SIZE];
+	struct net_buf *normal;
+	uint8_t packet_id;
+
+	ARRAY_FOR_EACH(high, i) {
+		high[i] = weave_packet_alloc_prio(&test_reserve_pool, 0x02, K_NO_WAIT);
+		zassert_not_null(high[i], "Alloc %d should succeed", i);
+	}
+
+	zassert_ok(weave_packet_get_id(high[0], &packet_id), "Metadata initialized");
+	zassert_equal(packet_id, 0x02);
+	zassert_is_null(weave_packet_alloc(&test_reserve_pool, K_NO_WAIT), "Pool exhausted");
+
+	/* Normal allocations may take any buffer a high one releases */
+	net_buf_unref(high[0]);
+	normal = weave_packet_alloc(&test_reserve_pool, K_NO_WAIT);
+	zassert_not_null(normal);
+	zassert_equal(weave_packet_pool_used(&test_reserve_pool, WEAVE_PACKET_PRIO_NORMAL), 1);
+
+	net_buf_unref(normal);
+	net_buf_unref(high[1]);
+	net_buf_unref(high[2]);
+	zassert_equal(pool_num_free(test_reserve_pool.pool), TEST_RESERVE_POOL_SIZE);
+}
+
+ZTEST(weave_packet_unit_test, test_reserve_plain_pool)
+{
+	struct net_buf *buf = weave_packet_alloc_prio(&test_pool, 0x03, K_NO_WAIT);
+	uint8_t packet_id;
+
+	/* Without a reserve, a high-priority allocation is a plain one */
+	zassert_not_null(buf);
+	zassert_ok(weave_packet_get_id(buf, &packet_id));
+	zassert_equal(packet_id, 0x03);
+	zassert_equal(weave_packet_pool_used(&test_pool, WEAVE_PACKET_PRIO_NORMAL), -EINVAL);
+	zassert_equal(weave_packet_pool_used(&test_reserve_pool, WEAVE_PACKET_PRIO_COUNT),
+		      -EINVAL);
+	zassert_is_null(weave_packet_alloc_prio(NULL, 0x03, K_NO_WAIT));
+
+	net_buf_unref(buf);
+}
+
+/* =============================================================================
+ * Elastic Pool Tests
+ * =============================================================================
+ */
+
+#define TEST_SHARED_RESERVE_SIZE 3
+#define TEST_ELASTIC_POOL_SIZE   1
+#define TEST_ELASTIC_LIMIT       2
+
+WEAVE_PACKET_SHARED_RESERVE_DEFINE(test_shared_reserve, TEST_SHARED_RESERVE_SIZE, TEST_BUF_SIZE);
+
+WEAVE_PACKET_ELASTIC_POOL_DEFINE(test_elastic_a, TEST_ELASTIC_POOL_SIZE, TEST_BUF_SIZE,
+				 test_shared_reserve, TEST_ELASTIC_LIMIT);
+WEAVE_PACKET_ELASTIC_POOL_DEFINE(test_elastic_b, TEST_ELASTIC_POOL_SIZE, TEST_BUF_SIZE,
+				 test_shared_reserve, TEST_ELASTIC_LIMIT);
+
+/* Buffers larger than the reserve's - must never borrow */
+WEAVE_PACKET_ELASTIC_POOL_DEFINE(test_elastic_large, TEST_ELASTIC_POOL_SIZE, TEST_BUF_SIZE * 2,
+				 test_shared_reserve, TEST_ELASTIC_LIMIT);
+
+static void elastic_reset_stats(void)
+{
+	atomic_clear(&test_elastic_a.borrow->borrows);
+	atomic_clear(&test_elastic_a.borrow->denied);
+	atomic_clear(&test_elastic_b.borrow->borrows);
+	atomic_clear(&test_elastic_b.borrow->denied);
+}
+
+ZTEST(weave_packet_unit_test, test_elastic_borrow_limit)
+{
+	struct net_buf *bufs[TEST_ELASTIC_POOL_SIZE + TEST_ELASTIC_LIMIT];
+	uint16_t counter_own, counter_borrowed;
+
+	elastic_reset_stats();
+
+	ARRAY_FOR_EACH(bufs, i) {
+		bufs[i] = weave_packet_alloc(&test_elastic_a, K_NO_WAIT);
+		zassert_not_null(bufs[i], "Alloc %d should succeed", i);
+	}
+
+	zassert_equal(pool_num_free(test_elastic_a.pool), 0, "Own buffers first");
+	zassert_equal(pool_num_free(test_shared_reserve.pool),
+		      TEST_SHARED_RESERVE_SIZE - TEST_ELASTIC_LIMIT);
+	zassert_equal(atomic_get(&test_elastic_a.borrow->borrowed), TEST_ELASTIC_LIMIT);
+	zassert_equal(atomic_get(&test_elastic_a.borrow->borrows), TEST_ELASTIC_LIMIT);
+
+	/* Borrowed buffers count in the borrowing pool's sequence */
+	zassert_ok(weave_packet_get_counter(bufs[0], &counter_own));
+	zassert_ok(weave_packet_get_counter(bufs[1], &counter_borrowed));
+	zassert_equal((uint16_t)(counter_borrowed - counter_own), 1);
+
+	zassert_is_null(weave_packet_alloc(&test_elastic_a, K_NO_WAIT), "Borrow limit reached");
+	zassert_equal(atomic_get(&test_elastic_a.borrow->denied), 1);
+
+	/* A released borrowed buffer goes back to the reserve */
+	net_buf_unref(bufs[1]);
+	zassert_equal(atomic_get(&test_elastic_a.borrow->borrowed), TEST_ELASTIC_LIMIT - 1);
+	zassert_equal(pool_num_free(test_shared_reserve.pool),
+		      TEST_SHARED_RESERVE_SIZE - TEST_ELASTIC_LIMIT + 1);
+
+	net_buf_unref(bufs[0]);
+	net_buf_unref(bufs[2]);
+	zassert_equal(atomic_get(&test_elastic_a.borrow->borrowed), 0);
+	zassert_equal(pool_num_free(test_elastic_a.pool), TEST_ELASTIC_POOL_SIZE);
+	zassert_equal(pool_num_free(test_shared_reserve.pool), TEST_SHARED_RESERVE_SIZE);
+}
+
+ZTEST(weave_packet_unit_test, test_elastic_reserve_too_small)
+{
+	struct net_buf *own = weave_packet_alloc(&test_elastic_large, K_NO_WAIT);
+
+	zassert_not_null(own, "Own buffers unaffected");
+	zassert_is_null(weave_packet_alloc(&test_elastic_large, K_NO_WAIT),
+			"Reserve buffers too small to borrow");
+	zassert_equal(atomic_get(&test_elastic_large.borrow->denied), 1);
+	zassert_equal(pool_num_free(test_shared_reserve.pool), TEST_SHARED_RESERVE_SIZE);
+
+	net_buf_unref(own);
+}
+
+ZTEST(weave_packet_unit_test, test_elastic_shared_between_pools)
+{
+	struct net_buf *a[TEST_ELASTIC_POOL_SIZE + TEST_ELASTIC_LIMIT];
+	struct net_buf *b[TEST_ELASTIC_POOL_SIZE + 1];
+
+	elastic_reset_stats();
+
+	ARRAY_FOR_EACH(a, i) {
+		a[i] = weave_packet_alloc(&test_elastic_a, K_NO_WAIT);
+		zassert_not_null(a[i]);
+	}
+	ARRAY_FOR_EACH(b, i) {
+		b[i] = weave_packet_alloc(&test_elastic_b, K_NO_WAIT);
+		zassert_not_null(b[i]);
+	}
+
+	/* Below its limit, but the reserve is empty */
+	zassert_is_null(weave_packet_alloc(&test_elastic_b, K_NO_WAIT), "Reserve exhausted");
+	zassert_equal(atomic_get(&test_elastic_b.borrow->denied), 1);
+	zassert_equal(atomic_get(&test_elastic_b.borrow->borrowed), 1);
+
+	/* A buffer returned by one pool can be borrowed by the other */
+	net_buf_unref(a[TEST_ELASTIC_POOL_SIZE]);
+	a[TEST_ELASTIC_POOL_SIZE] = NULL;
+	struct net_buf *extra = weave_packet_alloc(&test_elastic_b, K_NO_WAIT);
+
+	zassert_not_null(extra);
+	zassert_equal(atomic_get(&test_elastic_b.borrow->borrows), 2);
+
+	net_buf_unref(extra);
+	ARRAY_FOR_EACH(a, i) {
+		if (a[i]) {
+			net_buf_unref(a[i]);
+		}
+	}
+	ARRAY_FOR_EACH(b, i) {
+		net_buf_unref(b[i]);
+	}
+	zassert_equal(pool_num_free(test_shared_reserve.pool), TEST_SHARED_RESERVE_SIZE);
+}
@@ -0,0 +1,211 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/buf.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+#include <weave/packet_account.h>
+
+/* Test configuration constants */
+#define TEST_POOL_SIZE  8
+#define TEST_BUF_SIZE   16
+#define TEST_QUEUE_SIZE 8
+
+/* Events (and references) queued for n sinks sharing a queue */
+#define QUEUE_EVENTS(n) DIV_ROUND_UP(n, CONFIG_WEAVE_EVENT_MAX_TARGETS)
+
+/* =============================================================================
+ * Test Infrastructure
+ * =============================================================================
+ */
+
+WEAVE_PACKET_POOL_DEFINE(test_pool, TEST_POOL_SIZE, TEST_BUF_SIZE, NULL);
+
+WEAVE_MSGQ_DEFINE(test_queue, TEST_QUEUE_SIZE);
+
+/* Queued sinks sharing one queue, and an immediate sink */
+static void queued_handler(struct net_buf *buf, void *user_data);
+static void immediate_handler(struct net_buf *buf, void *user_data);
+
+WEAVE_PACKET_SINK_DEFINE(sink_queued_a, queued_handler, &test_queue, WV_NO_FILTER, NULL);
+WEAVE_PACKET_SINK_DEFINE(sink_queued_b, queued_handler, &test_queue, WV_NO_FILTER, NULL);
+WEAVE_PACKET_SINK_DEFINE(sink_immediate, immediate_handler, WV_IMMEDIATE, WV_NO_FILTER, NULL);
+
+WEAVE_PACKET_SOURCE_DEFINE(queued_source);
+WEAVE_PACKET_SOURCE_DEFINE(immediate_source);
+
+WEAVE_CONNECT(&queued_source, &sink_queued_a);
+WEAVE_CONNECT(&queued_source, &sink_queued_b);
+WEAVE_CONNECT(&immediate_source, &sink_immediate);
+
+WEAVE_PACKET_HOLDER_DEFINE(holder_a);
+WEAVE_PACKET_HOLDER_DEFINE(holder_b);
+WEAVE_PACKET_HOLDER_DEFINE(holder_c);
+WEAVE_PACKET_HOLDER_DEFINE(holder_d);
+WEAVE_PACKET_HOLDER_DEFINE(holder_e);
+
+/* Holdings seen from inside the handlers (most seen for the queue) */
+static uint32_t handler_refs;
+static uint32_t queued_refs_in_handler;
+
+/* References held by holder, 0 if it has none */
+static uint32_t refs_held(const void *holder, enum weave_packet_holder_kind kind)
+{
+	struct weave_packet_holding holdings[CONFIG_WEAVE_PACKET_ACCOUNTING_SLOTS];
+	size_t count = weave_packet_holdings(holdings, ARRAY_SIZE(holdings));
+
+	for (size_t i = 0; i < count; i++) {
+		if (holdings[i].holder == holder) {
+			zassert_equal(holdings[i].kind, kind, "Holder kind");
+			zassert_equal_ptr(holdings[i].pool, test_pool.pool, "Pool of the buffers");
+			return holdings[i].refs;
+		}
+	}
+
+	return 0;
+}
+
+static void queued_handler(struct net_buf *buf, void *user_data)
+{
+	ARG_UNUSED(buf);
+	ARG_UNUSED(user_data);
+
+	queued_refs_in_handler =
+		MAX(queued_refs_in_handler, refs_held(&test_queue, WEAVE_PACKET_HOLDER_QUEUE));
+}
+
+static void immediate_handler(struct net_buf *buf, void *user_data)
+{
+	ARG_UNUSED(buf);
+	ARG_UNUSED(user_data);
+
+	handler_refs = refs_held(&sink_immediate, WEAVE_PACKET_HOLDER_HANDLER);
+}
+
+static size_t pool_num_free(struct net_buf_pool *pool)
+{
+	return sys_sflist_len(&pool->free._queue.data_q) + pool->uninit_count;
+}
+
+/* =============================================================================
+ * Test Setup/Teardown
+ * =============================================================================
+ */
+
+static void test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	handler_refs = 0;
+	queued_refs_in_handler = 0;
+}
+
+static void test_teardown(void *fixture)
+{
+	struct weave_packet_holding holdings[CONFIG_WEAVE_PACKET_ACCOUNTING_SLOTS];
+
+	ARG_UNUSED(fixture);
+
+	while (weave_process_messages(&test_queue, K_NO_WAIT) > 0) {
+	}
+
+	/* Verify every reference was released, and counted as released */
+	zassert_equal(weave_packet_holdings(holdings, ARRAY_SIZE(holdings)), 0, "Nothing held");
+	zassert_equal(pool_num_free(test_pool.pool), TEST_POOL_SIZE, "Buffers freed");
+}
+
+ZTEST_SUITE(weave_packet_account_unit_test, NULL, NULL, test_setup, test_teardown, NULL);
+
+/* =============================================================================
+ * Tests
+ * =============================================================================
+ */
+
+ZTEST(weave_packet_account_unit_test, test_queue_holds_until_processed)
+{
+	struct net_buf *bufs[2];
+
+	ARRAY_FOR_EACH(bufs, i) {
+		bufs[i] = weave_packet_alloc(&test_pool, K_NO_WAIT);
+		zassert_not_null(bufs[i], "Alloc should succeed");
+		zassert_equal(weave_packet_send(&queued_source, bufs[i], K_NO_WAIT), 2);
+	}
+
+	/* Both sinks share the queue, and one reference per event */
+	zassert_equal(refs_held(&test_queue, WEAVE_PACKET_HOLDER_QUEUE),
+		      ARRAY_SIZE(bufs) * QUEUE_EVENTS(2));
+
+	while (weave_process_messages(&test_queue, K_NO_WAIT) > 0) {
+	}
+
+	zassert_equal(queued_refs_in_handler, ARRAY_SIZE(bufs) * QUEUE_EVENTS(2),
+		      "Held while handled");
+	zassert_equal(refs_held(&test_queue, WEAVE_PACKET_HOLDER_QUEUE), 0,
+		      "Released once handled");
+}
+
+ZTEST(weave_packet_account_unit_test, test_handler_holds_while_running)
+{
+	struct net_buf *buf = weave_packet_alloc(&test_pool, K_NO_WAIT);
+
+	zassert_not_null(buf, "Alloc should succeed");
+	zassert_equal(weave_packet_send(&immediate_source, buf, K_NO_WAIT), 1);
+
+	zassert_equal(handler_refs, 1, "Held by the handler's sink while it runs");
+	zassert_equal(refs_held(&sink_immediate, WEAVE_PACKET_HOLDER_HANDLER), 0,
+		      "Released when it returns");
+}
+
+ZTEST(weave_packet_account_unit_test, test_user_holder)
+{
+	struct net_buf *buf = weave_packet_alloc(&test_pool, K_NO_WAIT);
+
+	zassert_not_null(buf, "Alloc should succeed");
+	zassert_equal_ptr(weave_packet_hold(buf, &holder_a), buf);
+	weave_packet_hold(buf, &holder_a);
+	weave_packet_hold(buf, &holder_b);
+
+	zassert_equal(refs_held(&holder_a, WEAVE_PACKET_HOLDER_USER), 2);
+	zassert_equal(refs_held(&holder_b, WEAVE_PACKET_HOLDER_USER), 1);
+	zassert_equal(buf->ref, 4, "Holds are references");
+
+	/* The caller's own reference is not attributed */
+	net_buf_unref(buf);
+	weave_packet_unhold(buf, &holder_a);
+	zassert_equal(refs_held(&holder_a, WEAVE_PACKET_HOLDER_USER), 1);
+
+	weave_packet_holdings_dump();
+
+	weave_packet_unhold(buf, &holder_a);
+	weave_packet_unhold(buf, &holder_b);
+}
+
+ZTEST(weave_packet_account_unit_test, test_slots_exhausted)
+{
+	const struct weave_packet_holder *holders[] = {&holder_a, &holder_b, &holder_c, &holder_d,
+						       &holder_e};
+	struct net_buf *buf = weave_packet_alloc(&test_pool, K_NO_WAIT);
+	uint32_t missed = weave_packet_holdings_missed();
+
+	BUILD_ASSERT(ARRAY_SIZE(holders) > CONFIG_WEAVE_PACKET_ACCOUNTING_SLOTS);
+	zassert_not_null(buf, "Alloc should succeed");
+
+	ARRAY_FOR_EACH(holders, i) {
+		weave_packet_hold(buf, holders[i]);
+	}
+
+	zassert_equal(weave_packet_holdings_missed() - missed,
+		      ARRAY_SIZE(holders) - CONFIG_WEAVE_PACKET_ACCOUNTING_SLOTS);
+	zassert_equal(refs_held(&holder_e, WEAVE_PACKET_HOLDER_USER), 0, "Not counted");
+
+	/* Releasing a reference that was not counted changes nothing */
+	ARRAY_FOR_EACH(holders, i) {
+		weave_packet_unhold(buf, holders[i]);
+	}
+
+	net_buf_unref(buf);
+}
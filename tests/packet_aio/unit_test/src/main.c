@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/buf.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+#include <weave/packet_aio.h>
+
+/* Test configuration constants */
+#define TEST_POOL_SIZE     8
+#define TEST_BUF_SIZE      32
+#define TEST_MAX_IN_FLIGHT 2
+#define TEST_DEPTH         2
+
+/* =============================================================================
+ * Fake Backend - records submissions, completes on demand
+ * =============================================================================
+ */
+
+struct fake_backend {
+	struct net_buf *started[TEST_POOL_SIZE];
+	size_t num_started;
+	size_t num_completed;
+	int submit_result;
+	/* Complete each write from inside submit, like an empty UART packet */
+	bool complete_inline;
+	size_t num_inline;
+	int depth;
+	int max_depth;
+};
+
+static struct fake_backend backend;
+
+static int fake_submit(struct weave_packet_aio *aio, struct net_buf *buf)
+{
+	struct fake_backend *fake = aio->backend;
+
+	if (fake->submit_result < 0) {
+		return fake->submit_result;
+	}
+
+	if (fake->complete_inline) {
+		fake->num_inline++;
+		fake->max_depth = MAX(fake->max_depth, ++fake->depth);
+		weave_packet_aio_complete(aio, buf, 0);
+		fake->depth--;
+		return 0;
+	}
+
+	fake->started[fake->num_started++] = buf;
+	return 0;
+}
+
+/* Complete the oldest outstanding write */
+static void fake_complete(struct weave_packet_aio *aio, int result)
+{
+	struct fake_backend *fake = aio->backend;
+
+	zassert_true(fake->num_completed < fake->num_started, "Nothing in flight");
+	weave_packet_aio_complete(aio, fake->started[fake->num_completed++], result);
+}
+
+WEAVE_PACKET_AIO_DEFINE(test_aio, fake_submit, &backend, TEST_MAX_IN_FLIGHT, TEST_DEPTH);
+
+/* =============================================================================
+ * Pool, Source, Sink
+ * =============================================================================
+ */
+
+static atomic_t freed;
+
+static void test_destroy(struct net_buf *buf)
+{
+	atomic_inc(&freed);
+	net_buf_destroy(buf);
+}
+
+WEAVE_PACKET_POOL_DEFINE(test_pool, TEST_POOL_SIZE, TEST_BUF_SIZE, test_destroy);
+
+WEAVE_MSGQ_DEFINE(test_queue, 4);
+
+WEAVE_PACKET_SOURCE_DEFINE(test_source);
+WEAVE_PACKET_AIO_SINK_DEFINE(aio_sink, test_aio, &test_queue, WV_NO_FILTER);
+WEAVE_CONNECT(&test_source, &aio_sink);
+
+static struct net_buf *alloc_packet(uint8_t fill)
+{
+	struct net_buf *buf = weave_packet_alloc(&test_pool, K_NO_WAIT);
+
+	zassert_not_null(buf, "Alloc should succeed");
+	memset(net_buf_add(buf, 4), fill, 4);
+	return buf;
+}
+
+/* =============================================================================
+ * Test Setup/Teardown
+ * =============================================================================
+ */
+
+static void test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	memset(&backend, 0, sizeof(backend));
+	atomic_clear(&freed);
+	test_aio.completed = 0;
+	test_aio.errors = 0;
+	test_aio.dropped = 0;
+}
+
+static void test_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	while (weave_process_messages(&test_queue, K_NO_WAIT) > 0) {
+	}
+
+	/* Finish whatever the test left in flight */
+	backend.submit_result = 0;
+	while (backend.num_completed < backend.num_started) {
+		fake_complete(&test_aio, 0);
+	}
+
+	zassert_equal(test_aio.in_flight, 0, "No writes in flight");
+	zassert_equal(test_aio.waiting, 0, "No writes waiting");
+}
+
+ZTEST_SUITE(weave_packet_aio_unit_test, NULL, NULL, test_setup, test_teardown, NULL);
+
+/* =============================================================================
+ * Tests
+ * =============================================================================
+ */
+
+ZTEST(weave_packet_aio_unit_test, test_buffer_released_on_completion)
+{
+	struct net_buf *buf = alloc_packet(0xA1);
+
+	zassert_equal(weave_packet_send(&test_source, buf, K_NO_WAIT), 1, "Delivered to sink");
+	zassert_equal(weave_process_messages(&test_queue, K_NO_WAIT), 1, "Handler ran");
+
+	/* Handler returned, but the write is still in flight */
+	zassert_equal(backend.num_started, 1, "Write started");
+	zassert_equal_ptr(backend.started[0], buf, "Backend got the packet");
+	zassert_equal(buf->ref, 1, "Channel holds the only reference");
+	zassert_equal(atomic_get(&freed), 0, "Not freed before completion");
+
+	fake_complete(&test_aio, 0);
+	zassert_equal(atomic_get(&freed), 1, "Freed on completion");
+	zassert_equal(test_aio.completed, 1, "Completion counted");
+	zassert_equal(test_aio.in_flight, 0, "Slot released");
+}
+
+ZTEST(weave_packet_aio_unit_test, test_overlapping_writes_and_waiting)
+{
+	for (int i = 0; i < TEST_MAX_IN_FLIGHT + TEST_DEPTH; i++) {
+		zassert_ok(weave_packet_aio_write(&test_aio, alloc_packet(i)), "Write %d", i);
+	}
+
+	zassert_equal(backend.num_started, TEST_MAX_IN_FLIGHT, "Writes overlap up to the limit");
+	zassert_equal(test_aio.waiting, TEST_DEPTH, "Rest waits for a slot");
+
+	/* Ring full - dropped and released right away */
+	zassert_equal(weave_packet_aio_write(&test_aio, alloc_packet(0xFF)), -ENOBUFS,
+		      "Should drop when ring full");
+	zassert_equal(atomic_get(&freed), 1, "Dropped packet freed");
+	zassert_equal(test_aio.dropped, 1, "Drop counted");
+
+	/* Each completion starts the next waiting packet, in order */
+	fake_complete(&test_aio, 0);
+	zassert_equal(backend.num_started, TEST_MAX_IN_FLIGHT + 1, "Next write started");
+	zassert_equal(backend.started[TEST_MAX_IN_FLIGHT]->data[0], TEST_MAX_IN_FLIGHT,
+		      "FIFO order");
+}
+
+ZTEST(weave_packet_aio_unit_test, test_inline_completion_does_not_recurse)
+{
+	for (int i = 0; i < TEST_MAX_IN_FLIGHT + TEST_DEPTH; i++) {
+		zassert_ok(weave_packet_aio_write(&test_aio, alloc_packet(i)), "Write %d", i);
+	}
+
+	/* From now on the backend finishes every write before submit returns */
+	backend.complete_inline = true;
+	fake_complete(&test_aio, 0);
+
+	zassert_equal(backend.num_inline, TEST_DEPTH, "Waiting writes ran");
+	zassert_equal(backend.max_depth, 1, "Submit not re-entered from completion");
+	zassert_equal(test_aio.waiting, 0, "Ring drained");
+	zassert_equal(test_aio.in_flight, TEST_MAX_IN_FLIGHT - 1, "Only the old write in flight");
+}
+
+ZTEST(weave_packet_aio_unit_test, test_failed_submit_completes_with_error)
+{
+	backend.submit_result = -EIO;
+
+	zassert_ok(weave_packet_aio_write(&test_aio, alloc_packet(1)), "Write accepted");
+	zassert_equal(atomic_get(&freed), 1, "Packet released on submit failure");
+	zassert_equal(test_aio.errors, 1, "Error counted");
+	zassert_equal(test_aio.in_flight, 0, "Slot released");
+}
+
+ZTEST(weave_packet_aio_unit_test, test_error_completion)
+{
+	zassert_ok(weave_packet_aio_write(&test_aio, alloc_packet(1)), "Write accepted");
+
+	fake_complete(&test_aio, -ECONNRESET);
+	zassert_equal(test_aio.errors, 1, "Error counted");
+	zassert_equal(atomic_get(&freed), 1, "Packet released");
+}
+
+ZTEST(weave_packet_aio_unit_test, test_write_invalid)
+{
+	zassert_equal(weave_packet_aio_write(NULL, alloc_packet(1)), -EINVAL, "NULL channel");
+	zassert_equal(atomic_get(&freed), 1, "Reference consumed anyway");
+	zassert_equal(weave_packet_aio_write(&test_aio, NULL), -EINVAL, "NULL buffer");
+}
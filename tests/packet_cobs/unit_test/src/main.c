@@ -0,0 +1,292 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/buf.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+#include <weave/packet_cobs.h>
+
+/* Test configuration constants */
+#define TEST_POOL_SIZE 48
+#define TEST_BUF_SIZE  16
+#define TEST_MAX_LEN   300
+#define TEST_CAPTURES  4
+
+/* =============================================================================
+ * Pool, Source and Capture Sink
+ * =============================================================================
+ */
+
+/* Small buffers so frames and packets span several fragments */
+WEAVE_PACKET_POOL_DEFINE(test_pool, TEST_POOL_SIZE, TEST_BUF_SIZE, NULL);
+
+struct cobs_capture {
+	struct net_buf *bufs[TEST_CAPTURES];
+	size_t count;
+};
+
+static struct cobs_capture capture;
+
+static void capture_handler(struct net_buf *buf, void *user_data)
+{
+	struct cobs_capture *cap = user_data;
+
+	zassert_true(cap->count < TEST_CAPTURES, "Too many packets");
+	cap->bufs[cap->count++] = net_buf_ref(buf);
+}
+
+WEAVE_PACKET_SOURCE_DEFINE(rx_source);
+WEAVE_PACKET_SINK_DEFINE(rx_sink, capture_handler, WV_IMMEDIATE, WV_NO_FILTER, &capture);
+WEAVE_CONNECT(&rx_source, &rx_sink);
+
+static struct weave_packet_cobs_decoder decoder =
+	WEAVE_PACKET_COBS_DECODER_INITIALIZER(&test_pool, &rx_source);
+
+/* =============================================================================
+ * Helpers
+ * =============================================================================
+ */
+
+static struct net_buf *make_packet(const uint8_t *data, size_t len)
+{
+	struct net_buf *buf = weave_packet_alloc(&test_pool, K_NO_WAIT);
+	struct net_buf *tail = buf;
+
+	zassert_not_null(buf, "Alloc should succeed");
+
+	while (len > 0) {
+		if (net_buf_tailroom(tail) == 0) {
+			struct net_buf *frag = net_buf_alloc(test_pool.pool, K_NO_WAIT);
+
+			zassert_not_null(frag, "Alloc should succeed");
+			net_buf_frag_insert(tail, frag);
+			tail = frag;
+		}
+
+		size_t n = MIN(len, net_buf_tailroom(tail));
+
+		net_buf_add_mem(tail, data, n);
+		data += n;
+		len -= n;
+	}
+
+	return buf;
+}
+
+static size_t pool_num_free(struct net_buf_pool *pool)
+{
+	return sys_sflist_len(&pool->free._queue.data_q) + pool->uninit_count;
+}
+
+static size_t flatten(const struct net_buf *buf, uint8_t *out, size_t size)
+{
+	return net_buf_linearize(out, size, buf, 0, net_buf_frags_len(buf));
+}
+
+/* Encode data and check the frame against the expected bytes */
+static size_t encode_check(const uint8_t *data, size_t len, uint8_t *frame, size_t size)
+{
+	struct net_buf *buf = make_packet(data, len);
+	struct net_buf *enc = weave_packet_cobs_encode(buf, &test_pool, K_NO_WAIT);
+
+	zassert_not_null(enc, "Encode should succeed");
+
+	size_t frame_len = flatten(enc, frame, size);
+
+	zassert_true(frame_len <= WEAVE_PACKET_COBS_MAX_LEN(len), "Frame exceeds worst case");
+	zassert_equal(frame[frame_len - 1], WEAVE_PACKET_COBS_DELIMITER, "Frame ends in delimiter");
+	for (size_t i = 0; i < frame_len - 1; i++) {
+		zassert_not_equal(frame[i], 0, "No zero inside frame (offset %zu)", i);
+	}
+
+	net_buf_unref(enc);
+	net_buf_unref(buf);
+
+	return frame_len;
+}
+
+/* =============================================================================
+ * Test Setup/Teardown
+ * =============================================================================
+ */
+
+static void test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	weave_packet_cobs_decoder_reset(&decoder);
+	decoder.discard = false;
+	decoder.frames = 0;
+	decoder.errors = 0;
+	capture.count = 0;
+}
+
+static void test_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (size_t i = 0; i < capture.count; i++) {
+		net_buf_unref(capture.bufs[i]);
+	}
+	weave_packet_cobs_decoder_reset(&decoder);
+
+	/* Verify no buffer leaks */
+	zassert_equal(pool_num_free(test_pool.pool), TEST_POOL_SIZE, "All buffers should be freed");
+}
+
+ZTEST_SUITE(weave_packet_cobs_unit_test, NULL, NULL, test_setup, test_teardown, NULL);
+
+/* =============================================================================
+ * Encoder Tests
+ * =============================================================================
+ */
+
+ZTEST(weave_packet_cobs_unit_test, test_encode_known_vectors)
+{
+	uint8_t frame[16];
+
+	static const uint8_t in1[] = {0x00};
+	static const uint8_t out1[] = {0x01, 0x01, 0x00};
+	static const uint8_t in2[] = {0x11, 0x22, 0x00, 0x33};
+	static const uint8_t out2[] = {0x03, 0x11, 0x22, 0x02, 0x33, 0x00};
+	static const uint8_t in3[] = {0x11, 0x00, 0x00, 0x00};
+	static const uint8_t out3[] = {0x02, 0x11, 0x01, 0x01, 0x01, 0x00};
+
+	zassert_equal(encode_check(in1, sizeof(in1), frame, sizeof(frame)), sizeof(out1));
+	zassert_mem_equal(frame, out1, sizeof(out1));
+	zassert_equal(encode_check(in2, sizeof(in2), frame, sizeof(frame)), sizeof(out2));
+	zassert_mem_equal(frame, out2, sizeof(out2));
+	zassert_equal(encode_check(in3, sizeof(in3), frame, sizeof(frame)), sizeof(out3));
+	zassert_mem_equal(frame, out3, sizeof(out3));
+
+	/* Empty packet is a single empty block */
+	zassert_equal(encode_check(NULL, 0, frame, sizeof(frame)), 2);
+	zassert_equal(frame[0], 0x01);
+}
+
+ZTEST(weave_packet_cobs_unit_test, test_encode_long_block)
+{
+	static uint8_t data[TEST_MAX_LEN];
+	static uint8_t frame[WEAVE_PACKET_COBS_MAX_LEN(TEST_MAX_LEN)];
+
+	for (size_t i = 0; i < ARRAY_SIZE(data); i++) {
+		data[i] = (i % 255) + 1;
+	}
+
+	/* 254 non-zero bytes fill a block without implied zero */
+	size_t len = encode_check(data, ARRAY_SIZE(data), frame, sizeof(frame));
+
+	zassert_equal(len, ARRAY_SIZE(data) + 3, "Two code bytes plus delimiter");
+	zassert_equal(frame[0], 0xFF, "Full block");
+	zassert_equal(frame[255], ARRAY_SIZE(data) - 254 + 1, "Remainder block");
+}
+
+/* =============================================================================
+ * Decoder Tests
+ * =============================================================================
+ */
+
+ZTEST(weave_packet_cobs_unit_test, test_roundtrip_chunked)
+{
+	static uint8_t data[TEST_MAX_LEN / 2];
+	static uint8_t frame[WEAVE_PACKET_COBS_MAX_LEN(TEST_MAX_LEN / 2)];
+	uint8_t out[TEST_MAX_LEN / 2];
+
+	for (size_t i = 0; i < ARRAY_SIZE(data); i++) {
+		data[i] = (i % 7 == 0) ? 0 : i;
+	}
+
+	size_t frame_len = encode_check(data, ARRAY_SIZE(data), frame, sizeof(frame));
+
+	/* Feed the frame in odd-sized pieces, as RX events would */
+	for (size_t off = 0; off < frame_len; off += 5) {
+		zassert_true(weave_packet_cobs_decode(&decoder, frame + off,
+						      MIN(5, frame_len - off)) >= 0);
+	}
+
+	zassert_equal(capture.count, 1, "One packet decoded");
+	zassert_equal(decoder.frames, 1);
+	zassert_equal(flatten(capture.bufs[0], out, sizeof(out)), ARRAY_SIZE(data));
+	zassert_mem_equal(out, data, ARRAY_SIZE(data));
+}
+
+ZTEST(weave_packet_cobs_unit_test, test_decode_back_to_back)
+{
+	static const uint8_t stream[] = {0x00, 0x03, 'a', 'b', 0x00, 0x00, 0x02, 'c', 0x01, 0x00};
+	uint8_t out[8];
+
+	zassert_equal(weave_packet_cobs_decode(&decoder, stream, sizeof(stream)), 2);
+
+	/* Empty frames between delimiters are skipped */
+	zassert_equal(capture.count, 2);
+	zassert_equal(flatten(capture.bufs[0], out, sizeof(out)), 2);
+	zassert_mem_equal(out, "ab", 2);
+	zassert_equal(flatten(capture.bufs[1], out, sizeof(out)), 2);
+	zassert_mem_equal(out, "c\0", 2);
+	zassert_equal(decoder.errors, 0);
+}
+
+ZTEST(weave_packet_cobs_unit_test, test_decode_truncated_frame)
+{
+	/* First frame promises 4 data bytes but the delimiter comes early */
+	static const uint8_t stream[] = {0x05, 'a', 'b', 0x00, 0x03, 'x', 'y', 0x00};
+	uint8_t out[8];
+
+	zassert_equal(weave_packet_cobs_decode(&decoder, stream, sizeof(stream)), 1);
+	zassert_equal(decoder.errors, 1, "Truncated frame counted");
+	zassert_equal(capture.count, 1, "Next frame still decoded");
+	zassert_equal(flatten(capture.bufs[0], out, sizeof(out)), 2);
+	zassert_mem_equal(out, "xy", 2);
+}
+
+ZTEST(weave_packet_cobs_unit_test, test_decode_reset_resyncs)
+{
+	static const uint8_t partial[] = {0x04, 'a', 'b'};
+	static const uint8_t rest[] = {'c', 0x00, 0x02, 'z', 0x00};
+
+	zassert_equal(weave_packet_cobs_decode(&decoder, partial, sizeof(partial)), 0);
+
+	/* Line error - skip to the next delimiter */
+	weave_packet_cobs_decoder_reset(&decoder);
+
+	zassert_equal(weave_packet_cobs_decode(&decoder, rest, sizeof(rest)), 1);
+	zassert_equal(capture.count, 1);
+	zassert_equal(capture.bufs[0]->data[0], 'z');
+}
+
+ZTEST(weave_packet_cobs_unit_test, test_decode_pool_exhausted)
+{
+	static uint8_t frame[TEST_POOL_SIZE * TEST_BUF_SIZE + 8];
+	static const uint8_t next[] = {0x02, 'k', 0x00};
+
+	/* A frame longer than the whole pool */
+	size_t last = 0;
+
+	memset(frame, 'x', sizeof(frame));
+	for (size_t i = 0; i < sizeof(frame) - 1; i += 255) {
+		frame[i] = 0xFF;
+		last = i;
+	}
+	frame[last] = sizeof(frame) - 1 - last;
+	frame[sizeof(frame) - 1] = 0x00;
+
+	zassert_equal(weave_packet_cobs_decode(&decoder, frame, sizeof(frame)), 0);
+	zassert_equal(decoder.errors, 1, "Oversized frame dropped");
+
+	zassert_equal(weave_packet_cobs_decode(&decoder, next, sizeof(next)), 1);
+	zassert_equal(capture.count, 1, "Decoding recovers");
+}
+
+ZTEST(weave_packet_cobs_unit_test, test_invalid_args)
+{
+	uint8_t byte = 0;
+
+	zassert_equal(weave_packet_cobs_decode(NULL, &byte, 1), -EINVAL);
+	zassert_equal(weave_packet_cobs_decode(&decoder, NULL, 1), -EINVAL);
+	zassert_is_null(weave_packet_cobs_encode(NULL, &test_pool, K_NO_WAIT));
+	weave_packet_cobs_decoder_reset(NULL);
+}
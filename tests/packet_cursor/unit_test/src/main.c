@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/buf.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+#include <weave/packet_cursor.h>
+
+/* Test configuration constants */
+#define TEST_POOL_SIZE 16
+#define TEST_BUF_SIZE  16
+#define TEST_FRAG_LEN  3
+
+/* =============================================================================
+ * Test Packet
+ * =============================================================================
+ */
+
+WEAVE_PACKET_POOL_DEFINE(test_pool, TEST_POOL_SIZE, TEST_BUF_SIZE, NULL);
+
+/* Bytes 0x00..0x0B in fragments of 3 bytes: every wider value straddles */
+static const uint8_t test_data[] = {0x00, 0x01, 0x02, 0x03, 0x04, 0x05,
+				    0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B};
+
+static struct net_buf *test_buf;
+
+static struct net_buf *make_packet(const uint8_t *data, size_t len, size_t frag_len)
+{
+	struct net_buf *buf = weave_packet_alloc(&test_pool, K_NO_WAIT);
+	struct net_buf *tail = buf;
+
+	zassert_not_null(buf, "Alloc should succeed");
+
+	while (len > 0) {
+		if (tail->len == frag_len) {
+			struct net_buf *frag = net_buf_alloc(test_pool.pool, K_NO_WAIT);
+
+			zassert_not_null(frag, "Alloc should succeed");
+			net_buf_frag_insert(tail, frag);
+			tail = frag;
+		}
+
+		size_t n = MIN(len, frag_len - tail->len);
+
+		net_buf_add_mem(tail, data, n);
+		data += n;
+		len -= n;
+	}
+
+	return buf;
+}
+
+static size_t pool_num_free(struct net_buf_pool *pool)
+{
+	return sys_sflist_len(&pool->free._queue.data_q) + pool->uninit_count;
+}
+
+/* =============================================================================
+ * Test Setup/Teardown
+ * =============================================================================
+ */
+
+static void test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	test_buf = make_packet(test_data, sizeof(test_data), TEST_FRAG_LEN);
+}
+
+static void test_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	net_buf_unref(test_buf);
+
+	/* Verify no buffer leaks */
+	zassert_equal(pool_num_free(test_pool.pool), TEST_POOL_SIZE, "Buffers freed");
+}
+
+ZTEST_SUITE(weave_packet_cursor_unit_test, NULL, NULL, test_setup, test_teardown, NULL);
+
+/* =============================================================================
+ * Tests
+ * =============================================================================
+ */
+
+ZTEST(weave_packet_cursor_unit_test, test_read_across_fragments)
+{
+	struct weave_packet_cursor cursor;
+	uint8_t u8;
+	uint16_t u16;
+	uint32_t u32;
+	uint64_t u64;
+
+	weave_packet_cursor_init(&cursor, test_buf);
+
+	zassert_ok(weave_packet_cursor_read_u8(&cursor, &u8));
+	zassert_equal(u8, 0x00);
+	zassert_ok(weave_packet_cursor_read_le16(&cursor, &u16));
+	zassert_equal(u16, 0x0201, "Inside the first fragment");
+	zassert_ok(weave_packet_cursor_read_be16(&cursor, &u16));
+	zassert_equal(u16, 0x0304);
+	zassert_ok(weave_packet_cursor_read_le32(&cursor, &u32));
+	zassert_equal(u32, 0x08070605, "Spans two boundaries");
+
+	weave_packet_cursor_init(&cursor, test_buf);
+	zassert_ok(weave_packet_cursor_read_be32(&cursor, &u32));
+	zassert_equal(u32, 0x00010203);
+	zassert_ok(weave_packet_cursor_read_le64(&cursor, &u64));
+	zassert_equal(u64, 0x0B0A090807060504ULL, "Up to the last byte");
+	zassert_equal(weave_packet_cursor_remaining(&cursor), 0);
+
+	weave_packet_cursor_init(&cursor, test_buf);
+	zassert_ok(weave_packet_cursor_read_be64(&cursor, &u64));
+	zassert_equal(u64, 0x0001020304050607ULL);
+}
+
+ZTEST(weave_packet_cursor_unit_test, test_view)
+{
+	struct weave_packet_cursor cursor;
+
+	weave_packet_cursor_init(&cursor, test_buf);
+
+	/* In place: a pointer into the fragment itself */
+	zassert_equal_ptr(weave_packet_cursor_view(&cursor, TEST_FRAG_LEN), test_buf->data);
+	zassert_equal(weave_packet_cursor_contiguous(&cursor), TEST_FRAG_LEN);
+	zassert_is_null(weave_packet_cursor_view(&cursor, TEST_FRAG_LEN + 1),
+			"Straddles a boundary");
+
+	zassert_ok(weave_packet_cursor_skip(&cursor, 4));
+	zassert_equal_ptr(weave_packet_cursor_view(&cursor, 2), test_buf->frags->data + 1);
+	zassert_is_null(weave_packet_cursor_view(&cursor, 3));
+}
+
+ZTEST(weave_packet_cursor_unit_test, test_peek_and_skip)
+{
+	struct weave_packet_cursor cursor;
+	uint8_t data[5];
+
+	weave_packet_cursor_init(&cursor, test_buf);
+	zassert_equal(weave_packet_cursor_remaining(&cursor), sizeof(test_data));
+
+	zassert_ok(weave_packet_cursor_peek(&cursor, data, sizeof(data)));
+	zassert_mem_equal(data, test_data, sizeof(data));
+	zassert_equal(weave_packet_cursor_remaining(&cursor), sizeof(test_data), "Not moved");
+
+	zassert_ok(weave_packet_cursor_skip(&cursor, 6));
+	zassert_ok(weave_packet_cursor_read(&cursor, data, sizeof(data)));
+	zassert_mem_equal(data, &test_data[6], sizeof(data));
+	zassert_equal(weave_packet_cursor_remaining(&cursor), 1);
+}
+
+ZTEST(weave_packet_cursor_unit_test, test_past_end)
+{
+	struct weave_packet_cursor cursor;
+	uint8_t data[sizeof(test_data) + 1];
+	uint32_t u32 = 0xDEADBEEF;
+
+	weave_packet_cursor_init(&cursor, test_buf);
+	zassert_ok(weave_packet_cursor_skip(&cursor, 9));
+
+	zassert_equal(weave_packet_cursor_read_le32(&cursor, &u32), -ENODATA);
+	zassert_equal(u32, 0xDEADBEEF, "Value unchanged");
+	zassert_equal(weave_packet_cursor_skip(&cursor, 4), -ENODATA);
+	zassert_equal(weave_packet_cursor_write_le32(&cursor, 0), -ENODATA);
+	zassert_equal(weave_packet_cursor_remaining(&cursor), 3, "Cursor unchanged");
+	zassert_equal(test_buf->frags->frags->frags->data[0], 0x09, "Nothing written");
+
+	weave_packet_cursor_init(&cursor, test_buf);
+	zassert_equal(weave_packet_cursor_read(&cursor, data, sizeof(data)), -ENODATA);
+	zassert_equal(weave_packet_cursor_peek(&cursor, data, sizeof(data)), -ENODATA);
+}
+
+ZTEST(weave_packet_cursor_unit_test, test_write_across_fragments)
+{
+	struct weave_packet_cursor cursor;
+	uint16_t u16;
+	uint32_t u32;
+	uint64_t u64;
+
+	weave_packet_cursor_init(&cursor, test_buf);
+	zassert_ok(weave_packet_cursor_write_u8(&cursor, 0xAA));
+	zassert_ok(weave_packet_cursor_write_be16(&cursor, 0x1234));
+	zassert_ok(weave_packet_cursor_write_le32(&cursor, 0xCAFEF00D));
+	zassert_ok(weave_packet_cursor_write(&cursor, "xyz", 3));
+
+	/* The chain is written in place */
+	zassert_equal(test_buf->data[0], 0xAA);
+	zassert_equal(test_buf->data[1], 0x12);
+	zassert_equal(test_buf->frags->data[0], 0x0D);
+	zassert_equal(test_buf->frags->frags->data[0], 0xCA);
+	zassert_mem_equal(&test_buf->frags->frags->data[1], "xy", 2);
+
+	weave_packet_cursor_init(&cursor, test_buf);
+	zassert_ok(weave_packet_cursor_skip(&cursor, 1));
+	zassert_ok(weave_packet_cursor_read_be16(&cursor, &u16));
+	zassert_equal(u16, 0x1234);
+	zassert_ok(weave_packet_cursor_read_le32(&cursor, &u32));
+	zassert_equal(u32, 0xCAFEF00D);
+
+	weave_packet_cursor_init(&cursor, test_buf);
+	zassert_ok(weave_packet_cursor_skip(&cursor, 2));
+	zassert_ok(weave_packet_cursor_write_be64(&cursor, 0x1122334455667788ULL));
+	weave_packet_cursor_init(&cursor, test_buf);
+	zassert_ok(weave_packet_cursor_skip(&cursor, 2));
+	zassert_ok(weave_packet_cursor_read_be64(&cursor, &u64));
+	zassert_equal(u64, 0x1122334455667788ULL);
+}
+
+ZTEST(weave_packet_cursor_unit_test, test_empty_fragments)
+{
+	struct net_buf *buf = make_packet(test_data, 2, TEST_FRAG_LEN);
+	struct net_buf *empty = net_buf_alloc(test_pool.pool, K_NO_WAIT);
+	struct net_buf *tail = net_buf_alloc(test_pool.pool, K_NO_WAIT);
+	struct weave_packet_cursor cursor;
+	uint32_t u32;
+
+	/* Empty head, then data, an empty fragment and more data */
+	net_buf_pull(buf, 2);
+	net_buf_add_mem(tail, &test_data[2], 2);
+	net_buf_frag_add(buf, make_packet(test_data, 2, TEST_FRAG_LEN));
+	net_buf_frag_add(buf, empty);
+	net_buf_frag_add(buf, tail);
+
+	weave_packet_cursor_init(&cursor, buf);
+	zassert_equal(cursor.frag, buf->frags, "Empty head skipped");
+	zassert_equal(weave_packet_cursor_remaining(&cursor), 4);
+	zassert_ok(weave_packet_cursor_read_be32(&cursor, &u32));
+	zassert_equal(u32, 0x00010203);
+	zassert_is_null(cursor.frag, "At the end");
+
+	net_buf_unref(buf);
+}
+
+ZTEST(weave_packet_cursor_unit_test, test_empty_packet)
+{
+	struct weave_packet_cursor cursor;
+	uint8_t u8;
+
+	weave_packet_cursor_init(&cursor, NULL);
+	zassert_equal(weave_packet_cursor_remaining(&cursor), 0);
+	zassert_equal(weave_packet_cursor_contiguous(&cursor), 0);
+	zassert_is_null(weave_packet_cursor_view(&cursor, 0));
+	zassert_equal(weave_packet_cursor_read_u8(&cursor, &u8), -ENODATA);
+	zassert_ok(weave_packet_cursor_skip(&cursor, 0));
+}
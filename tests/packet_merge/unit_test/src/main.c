@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/buf.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+#include <weave/packet_merge.h>
+
+/* Test configuration constants */
+#define TEST_POOL_SIZE   16
+#define TEST_BUF_SIZE    16
+#define TEST_DEPTH       2
+#define TEST_MAX_OUTPUT  8
+#define TEST_LATENESS_US 10000
+
+/* =============================================================================
+ * Test Infrastructure
+ * =============================================================================
+ */
+
+WEAVE_PACKET_POOL_DEFINE(test_pool, TEST_POOL_SIZE, TEST_BUF_SIZE, NULL);
+
+/* Three streams; the lateness bound is long enough to never expire in a test */
+WEAVE_PACKET_MERGE_DEFINE(test_merge, 3, TEST_DEPTH, 1000000, WV_IMMEDIATE);
+
+/* Two inputs, only one connected, with a short lateness bound */
+WEAVE_PACKET_MERGE_DEFINE(quick_merge, 2, TEST_DEPTH, TEST_LATENESS_US, WV_IMMEDIATE);
+
+static void output_handler(struct net_buf *buf, void *user_data);
+
+WEAVE_PACKET_SINK_DEFINE(output_sink, output_handler, WV_IMMEDIATE, WV_NO_FILTER, NULL);
+
+WEAVE_PACKET_SOURCE_DEFINE(stream0);
+WEAVE_PACKET_SOURCE_DEFINE(stream1);
+WEAVE_PACKET_SOURCE_DEFINE(stream2);
+WEAVE_PACKET_SOURCE_DEFINE(quick_stream);
+
+WEAVE_CONNECT(&stream0, &test_merge_input0);
+WEAVE_CONNECT(&stream1, &test_merge_input1);
+WEAVE_CONNECT(&stream2, &test_merge_input2);
+WEAVE_CONNECT(&quick_stream, &quick_merge_input0);
+WEAVE_CONNECT(&test_merge.source, &output_sink);
+WEAVE_CONNECT(&quick_merge.source, &output_sink);
+
+/* Timestamps of the merged packets, relative to base */
+static uint32_t output[TEST_MAX_OUTPUT];
+static size_t output_count;
+
+/* Timestamp origin, moved forward per test so no test starts late */
+static uint32_t base;
+
+static void output_handler(struct net_buf *buf, void *user_data)
+{
+	uint32_t ticks;
+
+	ARG_UNUSED(user_data);
+
+	zassert_ok(weave_packet_get_timestamp_ticks(buf, &ticks));
+	zassert_true(output_count < TEST_MAX_OUTPUT, "Too many packets merged");
+	output[output_count++] = ticks - base;
+}
+
+/* Send a packet stamped offset ticks after base */
+static void send_at(struct weave_source *source, uint32_t offset)
+{
+	struct net_buf *buf = weave_packet_alloc(&test_pool, K_NO_WAIT);
+
+	zassert_not_null(buf, "Alloc should succeed");
+	zassert_ok(weave_packet_set_timestamp_ticks(buf, base + offset));
+	zassert_equal(weave_packet_send(source, buf, K_NO_WAIT), 1);
+}
+
+static void assert_output(const uint32_t *expected, size_t count)
+{
+	zassert_equal(output_count, count, "Merged packet count");
+	for (size_t i = 0; i < count; i++) {
+		zassert_equal(output[i], expected[i], "Packet %zu out of order", i);
+	}
+}
+
+static size_t pool_num_free(struct net_buf_pool *pool)
+{
+	return sys_sflist_len(&pool->free._queue.data_q) + pool->uninit_count;
+}
+
+/* =============================================================================
+ * Test Setup/Teardown
+ * =============================================================================
+ */
+
+static void test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	base = MAX(base + 1000, (uint32_t)k_uptime_ticks());
+	output_count = 0;
+	test_merge.merged = 0;
+	test_merge.late = 0;
+	test_merge.forced = 0;
+}
+
+static void test_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	weave_packet_merge_flush(&test_merge);
+	weave_packet_merge_flush(&quick_merge);
+
+	zassert_equal(pool_num_free(test_pool.pool), TEST_POOL_SIZE, "Buffers freed");
+}
+
+ZTEST_SUITE(weave_packet_merge_unit_test, NULL, NULL, test_setup, test_teardown, NULL);
+
+/* =============================================================================
+ * Tests
+ * =============================================================================
+ */
+
+ZTEST(weave_packet_merge_unit_test, test_merge_orders_streams)
+{
+	const uint32_t expected[] = {5, 10, 15, 20};
+
+	send_at(&stream0, 10);
+	send_at(&stream1, 20);
+	zassert_equal(output_count, 0, "Waits for stream2");
+
+	/* Every stream has a packet - the oldest is sent */
+	send_at(&stream2, 5);
+	zassert_equal(output_count, 1);
+
+	send_at(&stream2, 15);
+	zassert_equal(output_count, 2, "Stream0 ran empty");
+	zassert_equal(weave_packet_merge_pending(&test_merge), 2);
+
+	zassert_equal(weave_packet_merge_flush(&test_merge), 2);
+	assert_output(expected, ARRAY_SIZE(expected));
+	zassert_equal(test_merge.merged, ARRAY_SIZE(expected));
+}
+
+ZTEST(weave_packet_merge_unit_test, test_merge_drops_late)
+{
+	const uint32_t expected[] = {10, 20, 30};
+
+	send_at(&stream0, 10);
+	send_at(&stream1, 20);
+	send_at(&stream2, 30);
+	zassert_equal(output_count, 1);
+
+	/* Older than the packet sent, and older than stream1's buffered packet */
+	send_at(&stream0, 5);
+	send_at(&stream1, 15);
+	zassert_equal(test_merge.late, 2);
+	zassert_equal(weave_packet_merge_pending(&test_merge), 2, "Late packets not buffered");
+
+	weave_packet_merge_flush(&test_merge);
+	assert_output(expected, ARRAY_SIZE(expected));
+}
+
+ZTEST(weave_packet_merge_unit_test, test_merge_full_input)
+{
+	const uint32_t expected[] = {10, 20, 30};
+
+	BUILD_ASSERT(TEST_DEPTH == 2);
+
+	send_at(&stream0, 10);
+	send_at(&stream0, 20);
+	zassert_equal(output_count, 0);
+
+	/* No room for the third packet - the oldest goes out early */
+	send_at(&stream0, 30);
+	zassert_equal(output_count, 1);
+	zassert_equal(test_merge.forced, 1);
+	zassert_equal(weave_packet_merge_pending(&test_merge), TEST_DEPTH);
+
+	weave_packet_merge_flush(&test_merge);
+	assert_output(expected, ARRAY_SIZE(expected));
+}
+
+ZTEST(weave_packet_merge_unit_test, test_merge_lateness_bound)
+{
+	struct net_buf *buf = weave_packet_alloc(&test_pool, K_NO_WAIT);
+
+	zassert_not_null(buf, "Alloc should succeed");
+	zassert_equal(weave_packet_send(&quick_stream, buf, K_NO_WAIT), 1);
+	zassert_equal(output_count, 0, "Waits for the other stream");
+
+	/* The other stream stays silent - sent once the lateness bound expires */
+	k_sleep(K_USEC(TEST_LATENESS_US * 5));
+	zassert_equal(output_count, 1);
+	zassert_equal(weave_packet_merge_pending(&quick_merge), 0);
+}
+
+ZTEST(weave_packet_merge_unit_test, test_merge_invalid)
+{
+	zassert_equal(weave_packet_merge_flush(NULL), -EINVAL);
+	zassert_equal(weave_packet_merge_pending(NULL), -EINVAL);
+}
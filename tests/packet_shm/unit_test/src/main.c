@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/buf.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+#include <weave/packet_shm.h>
+
+/* Test configuration constants */
+#define TEST_POOL_SIZE 8
+#define TEST_BUF_SIZE  64
+#define TEST_RING_SIZE 256
+#define TEST_SLICES    4
+#define TEST_SHM_NAME  "/weave_packet_shm_unit_test"
+
+/* =============================================================================
+ * Both Ends of One Link - side 0 creates, side 1 attaches
+ * =============================================================================
+ */
+
+WEAVE_PACKET_POOL_DEFINE(test_pool, TEST_POOL_SIZE, TEST_BUF_SIZE, NULL);
+
+WEAVE_PACKET_SHM_DEFINE(link_a, TEST_SHM_NAME, 0, TEST_RING_SIZE, TEST_SLICES);
+WEAVE_PACKET_SHM_DEFINE(link_b, TEST_SHM_NAME, 1, TEST_RING_SIZE, TEST_SLICES);
+
+WEAVE_PACKET_SOURCE_DEFINE(a_tx_source);
+WEAVE_PACKET_SOURCE_DEFINE(b_tx_source);
+WEAVE_CONNECT(&a_tx_source, &link_a_sink);
+WEAVE_CONNECT(&b_tx_source, &link_b_sink);
+
+/* Capture sinks keep a reference to every packet received */
+struct shm_capture {
+	struct net_buf *bufs[TEST_SLICES + 1];
+	size_t count;
+};
+
+static struct shm_capture a_rx;
+static struct shm_capture b_rx;
+
+static void capture_handler(struct net_buf *buf, void *user_data)
+{
+	struct shm_capture *cap = user_data;
+
+	zassert_true(cap->count < ARRAY_SIZE(cap->bufs), "Too many packets");
+	cap->bufs[cap->count++] = net_buf_ref(buf);
+}
+
+WEAVE_PACKET_SINK_DEFINE(a_rx_sink, capture_handler, WV_IMMEDIATE, WV_NO_FILTER, &a_rx);
+WEAVE_PACKET_SINK_DEFINE(b_rx_sink, capture_handler, WV_IMMEDIATE, WV_NO_FILTER, &b_rx);
+WEAVE_CONNECT(&link_a_source, &a_rx_sink);
+WEAVE_CONNECT(&link_b_source, &b_rx_sink);
+
+/* =============================================================================
+ * Helpers
+ * =============================================================================
+ */
+
+static void send_fill(struct weave_source *source, size_t len, uint8_t fill)
+{
+	struct net_buf *buf = weave_packet_alloc(&test_pool, K_NO_WAIT);
+
+	zassert_not_null(buf, "Alloc should succeed");
+	memset(net_buf_add(buf, len), fill, len);
+	weave_packet_send(source, buf, K_NO_WAIT);
+}
+
+static void capture_release(struct shm_capture *cap)
+{
+	for (size_t i = 0; i < cap->count; i++) {
+		net_buf_unref(cap->bufs[i]);
+	}
+	cap->count = 0;
+}
+
+static uint32_t ring_used(struct weave_packet_shm_ring *ring)
+{
+	return (uint32_t)atomic_get(&ring->head) - (uint32_t)atomic_get(&ring->tail);
+}
+
+/* =============================================================================
+ * Test Setup/Teardown
+ * =============================================================================
+ */
+
+static void *suite_setup(void)
+{
+	zassert_ok(weave_packet_shm_init(&link_a, K_NO_WAIT), "Side 0 creates the link");
+	zassert_ok(weave_packet_shm_init(&link_b, K_SECONDS(1)), "Side 1 attaches");
+
+	return NULL;
+}
+
+static void test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	atomic_clear(&link_a.tx_dropped);
+	atomic_clear(&link_b.tx_dropped);
+}
+
+static void test_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	while (weave_packet_shm_receive(&link_a, K_NO_WAIT) > 0 ||
+	       weave_packet_shm_receive(&link_b, K_NO_WAIT) > 0) {
+		capture_release(&a_rx);
+		capture_release(&b_rx);
+	}
+	capture_release(&a_rx);
+	capture_release(&b_rx);
+
+	zassert_equal(ring_used(link_a.tx), 0, "Ring space returned");
+	zassert_equal(ring_used(link_b.tx), 0, "Ring space returned");
+}
+
+ZTEST_SUITE(weave_packet_shm_unit_test, NULL, suite_setup, test_setup, test_teardown, NULL);
+
+/* =============================================================================
+ * Tests
+ * =============================================================================
+ */
+
+ZTEST(weave_packet_shm_unit_test, test_roundtrip_with_metadata)
+{
+	struct net_buf *buf = weave_packet_alloc_with_id(&test_pool, 0x42, K_NO_WAIT);
+	uint16_t counter;
+	uint8_t id;
+	uint8_t client_id;
+
+	zassert_not_null(buf);
+	weave_packet_get_counter(buf, &counter);
+	weave_packet_set_client_id(buf, 7);
+	net_buf_add_mem(buf, "hello", 5);
+	weave_packet_send(&a_tx_source, buf, K_NO_WAIT);
+
+	zassert_equal(weave_packet_shm_receive(&link_b, K_NO_WAIT), 1, "One packet received");
+	zassert_equal(b_rx.count, 1);
+
+	struct net_buf *rx = b_rx.bufs[0];
+
+	zassert_equal(rx->len, 5);
+	zassert_mem_equal(rx->data, "hello", 5);
+	zassert_ok(weave_packet_get_id(rx, &id));
+	zassert_equal(id, 0x42, "Packet ID carried");
+	zassert_ok(weave_packet_get_client_id(rx, &client_id));
+	zassert_equal(client_id, 7, "Client ID carried");
+
+	uint16_t rx_counter;
+
+	zassert_ok(weave_packet_get_counter(rx, &rx_counter));
+	zassert_equal(rx_counter, counter, "Counter carried");
+}
+
+ZTEST(weave_packet_shm_unit_test, test_zero_copy_slice)
+{
+	send_fill(&a_tx_source, 16, 0xAB);
+	zassert_equal(weave_packet_shm_receive(&link_b, K_NO_WAIT), 1);
+
+	/* The slice points into the shared ring */
+	struct net_buf *rx = b_rx.bufs[0];
+
+	zassert_true(rx->data >= link_b.rx->data && rx->data < link_b.rx->data + TEST_RING_SIZE,
+		     "Slice is not a copy");
+	zassert_not_equal(ring_used(link_a.tx), 0, "Held slice keeps its record");
+
+	capture_release(&b_rx);
+	zassert_equal(ring_used(link_a.tx), 0, "Release returns the record");
+}
+
+ZTEST(weave_packet_shm_unit_test, test_pulled_slice_released)
+{
+	send_fill(&a_tx_source, 16, 0xCD);
+	zassert_equal(weave_packet_shm_receive(&link_b, K_NO_WAIT), 1);
+
+	/* A holder that strips a header still releases the right record */
+	net_buf_pull(b_rx.bufs[0], 4);
+	capture_release(&b_rx);
+	zassert_equal(ring_used(link_a.tx), 0, "Release returns the record");
+}
+
+ZTEST(weave_packet_shm_unit_test, test_fragments_gathered)
+{
+	struct net_buf *buf = weave_packet_alloc(&test_pool, K_NO_WAIT);
+	struct net_buf *frag = net_buf_alloc(test_pool.pool, K_NO_WAIT);
+
+	net_buf_add_mem(buf, "head:", 5);
+	net_buf_add_mem(frag, "payload", 7);
+	net_buf_frag_add(buf, frag);
+	weave_packet_send(&b_tx_source, buf, K_NO_WAIT);
+
+	zassert_equal(weave_packet_shm_receive(&link_a, K_NO_WAIT), 1, "Other direction");
+	zassert_equal(a_rx.bufs[0]->len, 12, "One record per packet");
+	zassert_mem_equal(a_rx.bufs[0]->data, "head:payload", 12);
+}
+
+ZTEST(weave_packet_shm_unit_test, test_out_of_order_release)
+{
+	for (int i = 0; i < 3; i++) {
+		send_fill(&a_tx_source, 8, i);
+	}
+	zassert_equal(weave_packet_shm_receive(&link_b, K_NO_WAIT), 3);
+
+	uint32_t used = ring_used(link_a.tx);
+
+	/* Releasing a later record returns nothing yet */
+	net_buf_unref(b_rx.bufs[1]);
+	zassert_equal(ring_used(link_a.tx), used, "Tail waits for the oldest record");
+
+	/* Releasing the oldest returns both */
+	net_buf_unref(b_rx.bufs[0]);
+	zassert_true(ring_used(link_a.tx) < used, "Tail skips released records");
+	zassert_not_equal(ring_used(link_a.tx), 0, "Last record still held");
+
+	net_buf_unref(b_rx.bufs[2]);
+	zassert_equal(ring_used(link_a.tx), 0);
+	b_rx.count = 0;
+}
+
+ZTEST(weave_packet_shm_unit_test, test_ring_full_drops)
+{
+	/* 56 byte payload + 8 byte header: at most four records fit */
+	for (int i = 0; i < 5; i++) {
+		send_fill(&a_tx_source, 56, i);
+	}
+
+	int dropped = atomic_get(&link_a.tx_dropped);
+
+	zassert_true(dropped >= 1, "Packets beyond the ring dropped");
+	zassert_equal(weave_packet_shm_receive(&link_b, K_NO_WAIT), 5 - dropped,
+		      "Packets that fit are received");
+}
+
+ZTEST(weave_packet_shm_unit_test, test_slices_exhausted)
+{
+	for (int i = 0; i < TEST_SLICES + 1; i++) {
+		send_fill(&a_tx_source, 8, i);
+	}
+
+	zassert_equal(weave_packet_shm_receive(&link_b, K_NO_WAIT), TEST_SLICES);
+	zassert_equal(weave_packet_shm_receive(&link_b, K_NO_WAIT), -EAGAIN,
+		      "Record waits for a free slice");
+
+	capture_release(&b_rx);
+	zassert_equal(weave_packet_shm_receive(&link_b, K_NO_WAIT), 1);
+	zassert_equal(b_rx.bufs[0]->data[0], TEST_SLICES, "Order kept");
+}
+
+ZTEST(weave_packet_shm_unit_test, test_wrap_around)
+{
+	/* 40 byte records do not divide the ring - forces padding at the end */
+	for (int i = 0; i < 20; i++) {
+		send_fill(&a_tx_source, 30, i);
+		zassert_equal(weave_packet_shm_receive(&link_b, K_NO_WAIT), 1, "Packet %d", i);
+		zassert_equal(b_rx.bufs[0]->len, 30);
+		zassert_equal(b_rx.bufs[0]->data[29], i, "Packet %d intact", i);
+		capture_release(&b_rx);
+	}
+
+	zassert_equal(atomic_get(&link_a.tx_dropped), 0, "Padding never drops");
+}
+
+ZTEST(weave_packet_shm_unit_test, test_receive_timeout)
+{
+	zassert_equal(weave_packet_shm_receive(&link_b, K_MSEC(5)), -EAGAIN);
+	zassert_equal(weave_packet_shm_receive(NULL, K_NO_WAIT), -EINVAL);
+}
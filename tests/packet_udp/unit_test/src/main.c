@@ -0,0 +1,306 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/buf.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+#include <weave/packet_udp.h>
+
+/* Test configuration constants */
+#define TEST_TX_POOL_SIZE 8
+#define TEST_TX_BUF_SIZE  128
+#define TEST_RX_POOL_SIZE 16
+#define TEST_RX_BUF_SIZE  64
+#define TEST_CAPTURES     8
+#define TEST_PORT_BASE    47001
+#define TEST_TIMEOUT_MS   200
+
+/* =============================================================================
+ * Three Transports on the Loopback Interface
+ * =============================================================================
+ */
+
+WEAVE_PACKET_POOL_DEFINE(tx_pool, TEST_TX_POOL_SIZE, TEST_TX_BUF_SIZE, NULL);
+WEAVE_PACKET_POOL_DEFINE(rx_pool, TEST_RX_POOL_SIZE, TEST_RX_BUF_SIZE, NULL);
+
+/* c sends from a queue, in batches */
+WEAVE_MSGQ_DEFINE(c_tx_queue, TEST_TX_POOL_SIZE);
+
+/* b knows a single peer, so a third sender is one too many */
+WEAVE_PACKET_UDP_DEFINE(udp_a, WV_IMMEDIATE, &rx_pool, 2);
+WEAVE_PACKET_UDP_DEFINE(udp_b, WV_IMMEDIATE, &rx_pool, 1);
+WEAVE_PACKET_UDP_DEFINE(udp_c, &c_tx_queue, &rx_pool, 2);
+
+WEAVE_PACKET_SOURCE_DEFINE(a_tx_source);
+WEAVE_PACKET_SOURCE_DEFINE(b_tx_source);
+WEAVE_PACKET_SOURCE_DEFINE(c_tx_source);
+WEAVE_BATCH_CONNECT(&a_tx_source, udp_a_sink);
+WEAVE_BATCH_CONNECT(&b_tx_source, udp_b_sink);
+WEAVE_BATCH_CONNECT(&c_tx_source, udp_c_sink);
+
+/* Capture sinks keep a reference to every packet received */
+struct udp_capture {
+	struct net_buf *bufs[TEST_CAPTURES];
+	size_t count;
+};
+
+static struct udp_capture a_rx;
+static struct udp_capture b_rx;
+static struct udp_capture c_rx;
+
+static void capture_handler(struct net_buf *buf, void *user_data)
+{
+	struct udp_capture *cap = user_data;
+
+	zassert_true(cap->count < TEST_CAPTURES, "Too many packets");
+	cap->bufs[cap->count++] = net_buf_ref(buf);
+}
+
+WEAVE_PACKET_SINK_DEFINE(a_rx_sink, capture_handler, WV_IMMEDIATE, WV_NO_FILTER, &a_rx);
+WEAVE_PACKET_SINK_DEFINE(b_rx_sink, capture_handler, WV_IMMEDIATE, WV_NO_FILTER, &b_rx);
+WEAVE_PACKET_SINK_DEFINE(c_rx_sink, capture_handler, WV_IMMEDIATE, WV_NO_FILTER, &c_rx);
+WEAVE_CONNECT(&udp_a_source, &a_rx_sink);
+WEAVE_CONNECT(&udp_b_source, &b_rx_sink);
+WEAVE_CONNECT(&udp_c_source, &c_rx_sink);
+
+static struct weave_packet_udp *const transports[] = {&udp_a, &udp_b, &udp_c};
+static struct udp_capture *const captures[] = {&a_rx, &b_rx, &c_rx};
+
+/* =============================================================================
+ * Helpers
+ * =============================================================================
+ */
+
+static struct sockaddr loopback_addr(int index)
+{
+	struct sockaddr addr = {0};
+	struct sockaddr_in *sin = net_sin(&addr);
+
+	sin->sin_family = AF_INET;
+	sin->sin_port = htons(TEST_PORT_BASE + index);
+	sin->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+	return addr;
+}
+
+static void send_to(struct weave_source *source, uint8_t client_id, const void *data, size_t len)
+{
+	struct net_buf *buf = weave_packet_alloc(&tx_pool, K_NO_WAIT);
+
+	zassert_not_null(buf, "Alloc should succeed");
+	weave_packet_set_client_id(buf, client_id);
+	net_buf_add_mem(buf, data, len);
+	weave_packet_send(source, buf, K_NO_WAIT);
+}
+
+/* Receive until cap holds count packets or nothing arrives in time */
+static void receive_until(struct weave_packet_udp *udp, struct udp_capture *cap, size_t count)
+{
+	struct zsock_pollfd fd = {.fd = udp->sock, .events = ZSOCK_POLLIN};
+
+	while (cap->count < count && zsock_poll(&fd, 1, TEST_TIMEOUT_MS) > 0) {
+		zassert_true(weave_packet_udp_receive(udp) > 0, "Readable socket has datagrams");
+	}
+
+	zassert_equal(cap->count, count, "Expected %zu packets", count);
+}
+
+static size_t pool_num_free(struct net_buf_pool *pool)
+{
+	return sys_sflist_len(&pool->free._queue.data_q) + pool->uninit_count;
+}
+
+/* =============================================================================
+ * Test Setup/Teardown
+ * =============================================================================
+ */
+
+static void *suite_setup(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(transports); i++) {
+		struct sockaddr addr = loopback_addr(i);
+
+		zassert_ok(weave_packet_udp_open(transports[i], &addr, sizeof(struct sockaddr_in)));
+	}
+
+	struct sockaddr a = loopback_addr(0);
+	struct sockaddr b = loopback_addr(1);
+	struct sockaddr c = loopback_addr(2);
+
+	zassert_equal(weave_packet_udp_add_peer(&udp_a, &b, sizeof(struct sockaddr_in)), 1);
+	zassert_equal(weave_packet_udp_add_peer(&udp_a, &c, sizeof(struct sockaddr_in)), 2);
+	zassert_equal(weave_packet_udp_add_peer(&udp_b, &a, sizeof(struct sockaddr_in)), 1);
+	zassert_equal(weave_packet_udp_add_peer(&udp_c, &a, sizeof(struct sockaddr_in)), 1);
+	zassert_equal(weave_packet_udp_add_peer(&udp_c, &b, sizeof(struct sockaddr_in)), 2);
+
+	return NULL;
+}
+
+static void test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (int i = 0; i < ARRAY_SIZE(transports); i++) {
+		atomic_clear(&transports[i]->rx_packets);
+		atomic_clear(&transports[i]->rx_batches);
+		atomic_clear(&transports[i]->rx_dropped);
+		atomic_clear(&transports[i]->tx_packets);
+		atomic_clear(&transports[i]->tx_dropped);
+	}
+}
+
+static void test_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	for (int i = 0; i < ARRAY_SIZE(captures); i++) {
+		for (size_t j = 0; j < captures[i]->count; j++) {
+			net_buf_unref(captures[i]->bufs[j]);
+		}
+		captures[i]->count = 0;
+	}
+
+	/* Verify no buffer leaks */
+	zassert_equal(pool_num_free(tx_pool.pool), TEST_TX_POOL_SIZE, "TX buffers freed");
+	zassert_equal(pool_num_free(rx_pool.pool), TEST_RX_POOL_SIZE, "RX buffers freed");
+}
+
+ZTEST_SUITE(weave_packet_udp_unit_test, NULL, suite_setup, test_setup, test_teardown, NULL);
+
+/* =============================================================================
+ * Tests
+ * =============================================================================
+ */
+
+ZTEST(weave_packet_udp_unit_test, test_roundtrip_client_id)
+{
+	uint8_t client_id;
+
+	send_to(&a_tx_source, 1, "ping", 4);
+	receive_until(&udp_b, &b_rx, 1);
+
+	zassert_equal(b_rx.bufs[0]->len, 4, "One datagram, one packet");
+	zassert_mem_equal(b_rx.bufs[0]->data, "ping", 4);
+	zassert_ok(weave_packet_get_client_id(b_rx.bufs[0], &client_id));
+	zassert_equal(client_id, 1, "Tagged with the sender");
+
+	/* Reply to the sender by its client_id */
+	send_to(&b_tx_source, client_id, "pong", 4);
+	receive_until(&udp_a, &a_rx, 1);
+
+	zassert_mem_equal(a_rx.bufs[0]->data, "pong", 4);
+	zassert_ok(weave_packet_get_client_id(a_rx.bufs[0], &client_id));
+	zassert_equal(client_id, 1, "b is a's first peer");
+}
+
+ZTEST(weave_packet_udp_unit_test, test_all_peers)
+{
+	send_to(&a_tx_source, WEAVE_PACKET_UDP_ALL_PEERS, "all", 3);
+
+	zassert_equal(atomic_get(&udp_a.tx_packets), 2, "One datagram per peer");
+	receive_until(&udp_b, &b_rx, 1);
+	receive_until(&udp_c, &c_rx, 1);
+	zassert_mem_equal(c_rx.bufs[0]->data, "all", 3);
+}
+
+ZTEST(weave_packet_udp_unit_test, test_fragments_one_datagram)
+{
+	struct net_buf *buf = weave_packet_alloc(&tx_pool, K_NO_WAIT);
+	struct net_buf *frag = net_buf_alloc(tx_pool.pool, K_NO_WAIT);
+
+	weave_packet_set_client_id(buf, 1);
+	net_buf_add_mem(buf, "head:", 5);
+	net_buf_add_mem(frag, "payload", 7);
+	net_buf_frag_add(buf, frag);
+	weave_packet_send(&a_tx_source, buf, K_NO_WAIT);
+
+	receive_until(&udp_b, &b_rx, 1);
+	zassert_equal(b_rx.bufs[0]->len, 12, "Fragments gathered");
+	zassert_mem_equal(b_rx.bufs[0]->data, "head:payload", 12);
+}
+
+ZTEST(weave_packet_udp_unit_test, test_batch_limit)
+{
+	int total = CONFIG_WEAVE_PACKET_UDP_RX_BATCH + 2;
+
+	for (int i = 0; i < total; i++) {
+		send_to(&a_tx_source, 1, &i, 1);
+	}
+
+	/* Let every datagram reach the socket */
+	k_msleep(TEST_TIMEOUT_MS);
+
+	zassert_equal(weave_packet_udp_receive(&udp_b), CONFIG_WEAVE_PACKET_UDP_RX_BATCH);
+	zassert_equal(weave_packet_udp_receive(&udp_b), 2);
+	zassert_equal(weave_packet_udp_receive(&udp_b), 0, "Nothing left");
+	zassert_equal(atomic_get(&udp_b.rx_batches), 2);
+
+	for (int i = 0; i < total; i++) {
+		zassert_equal(b_rx.bufs[i]->data[0], i, "Order kept");
+	}
+}
+
+ZTEST(weave_packet_udp_unit_test, test_queued_send_batch)
+{
+	for (int i = 0; i < 3; i++) {
+		send_to(&c_tx_source, 1, &i, 1);
+	}
+	zassert_equal(atomic_get(&udp_c.tx_packets), 0, "Queued until processed");
+
+	/* One handler call sends the whole batch */
+	zassert_equal(weave_process_messages(&c_tx_queue, K_NO_WAIT), 3);
+	zassert_equal(atomic_get(&udp_c.tx_packets), 3);
+
+	receive_until(&udp_a, &a_rx, 3);
+	for (int i = 0; i < 3; i++) {
+		zassert_equal(a_rx.bufs[i]->data[0], i, "Order kept");
+	}
+}
+
+ZTEST(weave_packet_udp_unit_test, test_unknown_client_dropped)
+{
+	send_to(&a_tx_source, 9, "lost", 4);
+
+	zassert_equal(atomic_get(&udp_a.tx_dropped), 1, "No peer 9");
+	zassert_equal(atomic_get(&udp_a.tx_packets), 0);
+}
+
+ZTEST(weave_packet_udp_unit_test, test_peer_table_full)
+{
+	/* c is b's second sender; b has room for one */
+	send_to(&c_tx_source, 2, "full", 4);
+	zassert_equal(weave_process_messages(&c_tx_queue, K_NO_WAIT), 1);
+	k_msleep(TEST_TIMEOUT_MS);
+
+	zassert_equal(weave_packet_udp_receive(&udp_b), 1, "Datagram read");
+	zassert_equal(b_rx.count, 0, "Not delivered");
+	zassert_equal(atomic_get(&udp_b.rx_dropped), 1);
+}
+
+ZTEST(weave_packet_udp_unit_test, test_oversized_dropped)
+{
+	static const uint8_t big[TEST_RX_BUF_SIZE + 1];
+
+	send_to(&a_tx_source, 1, big, sizeof(big));
+	send_to(&a_tx_source, 1, "next", 4);
+
+	receive_until(&udp_b, &b_rx, 1);
+	zassert_equal(atomic_get(&udp_b.rx_dropped), 1, "Longer than an RX buffer");
+	zassert_mem_equal(b_rx.bufs[0]->data, "next", 4);
+}
+
+ZTEST(weave_packet_udp_unit_test, test_invalid_args)
+{
+	struct sockaddr addr = loopback_addr(0);
+
+	zassert_equal(weave_packet_udp_open(NULL, &addr, sizeof(struct sockaddr_in)), -EINVAL);
+	zassert_equal(weave_packet_udp_open(&udp_a, &addr, sizeof(struct sockaddr_in)), -EALREADY);
+	zassert_equal(weave_packet_udp_add_peer(&udp_a, NULL, 0), -EINVAL);
+	zassert_equal(weave_packet_udp_receive(NULL), -EINVAL);
+	weave_packet_udp_close(NULL);
+}
@@ -0,0 +1,296 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+#include <weave/packet_wire.h>
+
+/* Test configuration constants */
+#define TEST_LEN          32
+#define TEST_PERIOD_NS    1000000
+#define TEST_START_NS     123456789012ULL
+#define TEST_ALL_FIELDS   WEAVE_PACKET_WIRE_F_FIELDS
+#define TEST_SENSOR_FIELDS                                                                         \
+	(WEAVE_PACKET_WIRE_F_ID | WEAVE_PACKET_WIRE_F_COUNTER | WEAVE_PACKET_WIRE_F_TIMESTAMP)
+
+/* =============================================================================
+ * Encoder and Decoder of One Connection
+ * =============================================================================
+ */
+
+static struct weave_packet_wire_ctx tx_ctx;
+static struct weave_packet_wire_ctx rx_ctx;
+
+/* Encode hdr and decode it again, returning the header length */
+static int roundtrip(const struct weave_packet_wire_hdr *hdr, struct weave_packet_wire_hdr *out)
+{
+	uint8_t wire[WEAVE_PACKET_WIRE_HDR_MAX];
+	int len = weave_packet_wire_encode(&tx_ctx, hdr, wire, sizeof(wire));
+
+	zassert_true(len > 0, "Encode should succeed: %d", len);
+	zassert_equal(weave_packet_wire_decode(&rx_ctx, wire, len, out), len,
+		      "Decode should read the whole header");
+
+	return len;
+}
+
+static void assert_hdr_equal(const struct weave_packet_wire_hdr *a,
+			     const struct weave_packet_wire_hdr *b)
+{
+	zassert_equal(a->flags, b->flags);
+	zassert_equal(a->len, b->len);
+	zassert_equal(a->packet_id, b->packet_id);
+	zassert_equal(a->client_id, b->client_id);
+	zassert_equal(a->counter, b->counter);
+	zassert_equal(a->timestamp_ns, b->timestamp_ns);
+}
+
+/* =============================================================================
+ * Test Setup
+ * =============================================================================
+ */
+
+static void test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	weave_packet_wire_reset(&tx_ctx);
+	weave_packet_wire_reset(&rx_ctx);
+}
+
+ZTEST_SUITE(weave_packet_wire_unit_test, NULL, NULL, test_setup, NULL, NULL);
+
+/* =============================================================================
+ * Tests
+ * =============================================================================
+ */
+
+ZTEST(weave_packet_wire_unit_test, test_sync_then_delta)
+{
+	struct weave_packet_wire_hdr hdr = {
+		.flags = TEST_ALL_FIELDS,
+		.len = TEST_LEN,
+		.packet_id = 0x42,
+		.client_id = 7,
+		.counter = 1000,
+		.timestamp_ns = TEST_START_NS,
+	};
+	struct weave_packet_wire_hdr out;
+	uint8_t wire[WEAVE_PACKET_WIRE_HDR_MAX];
+
+	/* First header carries absolute values */
+	zassert_true(weave_packet_wire_encode(&tx_ctx, &hdr, wire, sizeof(wire)) > 0);
+	zassert_true(wire[0] & WEAVE_PACKET_WIRE_F_SYNC, "First header syncs");
+	zassert_true(weave_packet_wire_decode(&rx_ctx, wire, sizeof(wire), &out) > 0);
+	assert_hdr_equal(&hdr, &out);
+
+	for (int i = 0; i < 10; i++) {
+		hdr.counter++;
+		hdr.timestamp_ns += TEST_PERIOD_NS;
+		hdr.len = TEST_LEN + i;
+
+		zassert_true(weave_packet_wire_encode(&tx_ctx, &hdr, wire, sizeof(wire)) > 0);
+		zassert_false(wire[0] & WEAVE_PACKET_WIRE_F_SYNC, "Later headers are deltas");
+		zassert_true(weave_packet_wire_decode(&rx_ctx, wire, sizeof(wire), &out) > 0);
+		assert_hdr_equal(&hdr, &out);
+	}
+}
+
+ZTEST(weave_packet_wire_unit_test, test_header_size)
+{
+	struct weave_packet_wire_hdr hdr = {
+		.flags = TEST_SENSOR_FIELDS,
+		.len = TEST_LEN,
+		.packet_id = 0x01,
+		.counter = 1,
+		.timestamp_ns = TEST_START_NS,
+	};
+	struct weave_packet_wire_hdr out;
+
+	zassert_true(roundtrip(&hdr, &out) <= 10, "Sync header");
+
+	/* flags, len, id, counter delta, 1 ms timestamp delta */
+	hdr.counter++;
+	hdr.timestamp_ns += TEST_PERIOD_NS;
+	zassert_equal(roundtrip(&hdr, &out), 7, "Delta header");
+
+	/* Only the length */
+	hdr.flags = 0;
+	zassert_equal(roundtrip(&hdr, &out), 2, "Bare header");
+}
+
+ZTEST(weave_packet_wire_unit_test, test_max_header)
+{
+	struct weave_packet_wire_hdr hdr = {
+		.flags = TEST_ALL_FIELDS,
+		.len = UINT16_MAX,
+		.packet_id = UINT8_MAX,
+		.client_id = UINT8_MAX,
+		.counter = UINT16_MAX,
+		.timestamp_ns = UINT64_MAX,
+	};
+	struct weave_packet_wire_hdr out;
+
+	zassert_equal(roundtrip(&hdr, &out), WEAVE_PACKET_WIRE_HDR_MAX);
+	assert_hdr_equal(&hdr, &out);
+}
+
+ZTEST(weave_packet_wire_unit_test, test_wrap_and_backwards)
+{
+	struct weave_packet_wire_hdr hdr = {
+		.flags = TEST_ALL_FIELDS,
+		.counter = UINT16_MAX - 1,
+		.timestamp_ns = TEST_START_NS,
+	};
+	struct weave_packet_wire_hdr out;
+
+	roundtrip(&hdr, &out);
+
+	/* Counter wraps to 0 with a delta of 2 */
+	hdr.counter = 0;
+	hdr.timestamp_ns += TEST_PERIOD_NS;
+	zassert_equal(roundtrip(&hdr, &out), 8, "Both deltas short");
+	assert_hdr_equal(&hdr, &out);
+
+	/* Timestamps of another clock domain may step back */
+	hdr.counter = 1;
+	hdr.timestamp_ns -= 3 * TEST_PERIOD_NS;
+	roundtrip(&hdr, &out);
+	assert_hdr_equal(&hdr, &out);
+
+	/* Far jumps still decode exactly */
+	hdr.counter = 0x8000;
+	hdr.timestamp_ns = 1;
+	roundtrip(&hdr, &out);
+	assert_hdr_equal(&hdr, &out);
+}
+
+ZTEST(weave_packet_wire_unit_test, test_absent_fields_keep_base)
+{
+	struct weave_packet_wire_hdr hdr = {
+		.flags = TEST_SENSOR_FIELDS,
+		.counter = 10,
+		.timestamp_ns = TEST_START_NS,
+	};
+	struct weave_packet_wire_hdr out;
+
+	roundtrip(&hdr, &out);
+
+	/* A header without counter and timestamp leaves the deltas alone */
+	hdr.flags = WEAVE_PACKET_WIRE_F_ID;
+	roundtrip(&hdr, &out);
+	zassert_equal(out.flags, WEAVE_PACKET_WIRE_F_ID);
+
+	hdr.flags = TEST_SENSOR_FIELDS;
+	hdr.counter = 11;
+	hdr.timestamp_ns += TEST_PERIOD_NS;
+	roundtrip(&hdr, &out);
+	assert_hdr_equal(&hdr, &out);
+}
+
+ZTEST(weave_packet_wire_unit_test, test_truncated)
+{
+	struct weave_packet_wire_hdr hdr = {
+		.flags = TEST_ALL_FIELDS,
+		.len = 300,
+		.counter = 500,
+		.timestamp_ns = TEST_START_NS,
+	};
+	struct weave_packet_wire_hdr out;
+	uint8_t wire[WEAVE_PACKET_WIRE_HDR_MAX];
+	int len = weave_packet_wire_encode(&tx_ctx, &hdr, wire, sizeof(wire));
+
+	/* Every prefix is incomplete and leaves the decoder untouched */
+	for (int i = 0; i < len; i++) {
+		zassert_equal(weave_packet_wire_decode(&rx_ctx, wire, i, &out), -EAGAIN,
+			      "Prefix of %d bytes", i);
+		zassert_false(rx_ctx.synced, "Decoder not synced by a partial header");
+	}
+
+	zassert_equal(weave_packet_wire_decode(&rx_ctx, wire, len, &out), len);
+	assert_hdr_equal(&hdr, &out);
+}
+
+ZTEST(weave_packet_wire_unit_test, test_malformed)
+{
+	struct weave_packet_wire_hdr out;
+
+	/* Reserved flag bits */
+	static const uint8_t reserved[] = {0x80, 0x00};
+	/* Length varint longer than 16 bits allow */
+	static const uint8_t long_len[] = {0x00, 0xFF, 0xFF, 0xFF, 0x01};
+	/* Length of 65536 */
+	static const uint8_t big_len[] = {0x00, 0x80, 0x80, 0x04};
+	/* Timestamp varint of 11 bytes */
+	static const uint8_t long_ts[] = {WEAVE_PACKET_WIRE_F_SYNC | WEAVE_PACKET_WIRE_F_TIMESTAMP,
+					  0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+					  0xFF, 0xFF, 0xFF, 0xFF, 0x01};
+
+	zassert_equal(weave_packet_wire_decode(&rx_ctx, reserved, sizeof(reserved), &out), -EINVAL);
+	zassert_equal(weave_packet_wire_decode(&rx_ctx, long_len, sizeof(long_len), &out), -EINVAL);
+	zassert_equal(weave_packet_wire_decode(&rx_ctx, big_len, sizeof(big_len), &out), -EINVAL);
+	zassert_equal(weave_packet_wire_decode(&rx_ctx, long_ts, sizeof(long_ts), &out), -EINVAL);
+	zassert_false(rx_ctx.synced, "Malformed sync header ignored");
+}
+
+ZTEST(weave_packet_wire_unit_test, test_delta_before_sync)
+{
+	struct weave_packet_wire_hdr hdr = {
+		.flags = TEST_SENSOR_FIELDS,
+		.len = TEST_LEN,
+		.packet_id = 0x05,
+		.counter = 1,
+		.timestamp_ns = TEST_START_NS,
+	};
+	struct weave_packet_wire_hdr out;
+	uint8_t wire[WEAVE_PACKET_WIRE_HDR_MAX];
+	int len;
+
+	/* The decoder missed the sync header */
+	weave_packet_wire_encode(&tx_ctx, &hdr, wire, sizeof(wire));
+	hdr.counter++;
+	hdr.timestamp_ns += TEST_PERIOD_NS;
+	len = weave_packet_wire_encode(&tx_ctx, &hdr, wire, sizeof(wire));
+
+	/* Length and IDs still decode, so a stream can skip the payload */
+	zassert_equal(weave_packet_wire_decode(&rx_ctx, wire, len, &out), len);
+	zassert_equal(out.flags, WEAVE_PACKET_WIRE_F_ID, "Unresolved deltas dropped");
+	zassert_equal(out.len, TEST_LEN);
+	zassert_equal(out.packet_id, 0x05);
+
+	/* The encoder resyncs the connection */
+	weave_packet_wire_reset(&tx_ctx);
+	hdr.counter++;
+	roundtrip(&hdr, &out);
+	assert_hdr_equal(&hdr, &out);
+}
+
+ZTEST(weave_packet_wire_unit_test, test_encode_short_buffer)
+{
+	struct weave_packet_wire_hdr hdr = {
+		.flags = TEST_ALL_FIELDS,
+		.counter = 1,
+		.timestamp_ns = TEST_START_NS,
+	};
+	uint8_t wire[4];
+
+	zassert_equal(weave_packet_wire_encode(&tx_ctx, &hdr, wire, sizeof(wire)), -ENOMEM);
+	zassert_false(tx_ctx.synced, "Encoder state unchanged");
+}
+
+ZTEST(weave_packet_wire_unit_test, test_invalid_args)
+{
+	struct weave_packet_wire_hdr hdr = {.flags = WEAVE_PACKET_WIRE_F_SYNC};
+	uint8_t wire[WEAVE_PACKET_WIRE_HDR_MAX];
+
+	zassert_equal(weave_packet_wire_encode(&tx_ctx, &hdr, wire, sizeof(wire)), -EINVAL,
+		      "SYNC is not a field");
+	zassert_equal(weave_packet_wire_encode(NULL, &hdr, wire, sizeof(wire)), -EINVAL);
+	zassert_equal(weave_packet_wire_encode(&tx_ctx, NULL, wire, sizeof(wire)), -EINVAL);
+	zassert_equal(weave_packet_wire_decode(&rx_ctx, NULL, 0, &hdr), -EINVAL);
+	zassert_equal(weave_packet_wire_decode(&rx_ctx, wire, sizeof(wire), NULL), -EINVAL);
+}
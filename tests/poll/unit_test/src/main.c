@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2026 Zephyr Project
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/ztest.h>
+#include <zephyr/zvfs/eventfd.h>
+#include <weave/poll.h>
+
+/* Test configuration constants */
+#define TEST_QUEUE_SIZE 4
+#define TEST_TIMEOUT_MS 100
+
+/* =============================================================================
+ * Test Capture Context
+ * =============================================================================
+ */
+
+struct poll_capture {
+	atomic_t count;
+	void *last_ptr;
+};
+
+static struct poll_capture captures[2];
+
+static void capture_handler(void *ptr, void *user_data)
+{
+	struct poll_capture *capture = (struct poll_capture *)user_data;
+
+	atomic_inc(&capture->count);
+	capture->last_ptr = ptr;
+}
+
+/* =============================================================================
+ * Queues and Sinks
+ * =============================================================================
+ */
+
+WEAVE_POLL_MSGQ_DEFINE(queue_a, TEST_QUEUE_SIZE);
+WEAVE_POLL_MSGQ_DEFINE(queue_b, TEST_QUEUE_SIZE);
+
+WEAVE_SINK_DEFINE(sink_a, capture_handler, &queue_a, &captures[0]);
+WEAVE_SINK_DEFINE(sink_b, capture_handler, &queue_b, &captures[1]);
+
+static struct weave_poll_queue *const queues[] = {&queue_a_poll, &queue_b_poll};
+
+/* Stands in for a socket: any pollable file descriptor works */
+static int fake_sock = -1;
+
+/* =============================================================================
+ * Test Setup/Teardown
+ * =============================================================================
+ */
+
+static void *suite_setup(void)
+{
+	fake_sock = zvfs_eventfd(0, ZVFS_EFD_NONBLOCK);
+	zassert_true(fake_sock >= 0, "eventfd should be created");
+
+	return NULL;
+}
+
+static void test_setup(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	ARRAY_FOR_EACH_PTR(captures, capture) {
+		atomic_clear(&capture->count);
+		capture->last_ptr = NULL;
+	}
+}
+
+static void test_teardown(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	zvfs_eventfd_t value;
+
+	/* Drain anything left, then clear the fake socket */
+	weave_poll(NULL, 0, queues, ARRAY_SIZE(queues), 0);
+	zvfs_eventfd_read(fake_sock, &value);
+
+	zassert_equal(k_msgq_num_used_get(&queue_a), 0, "Queue A should be empty");
+	zassert_equal(k_msgq_num_used_get(&queue_b), 0, "Queue B should be empty");
+}
+
+ZTEST_SUITE(weave_poll_unit_test, NULL, suite_setup, test_setup, test_teardown, NULL);
+
+/* =============================================================================
+ * Tests
+ * =============================================================================
+ */
+
+ZTEST(weave_poll_unit_test, test_poll_processes_ready_queue)
+{
+	int test_data = 0x113;
+	struct zsock_pollfd fds[] = {{.fd = fake_sock, .events = ZSOCK_POLLIN}};
+
+	zassert_ok(weave_sink_send(&sink_b, &test_data, NULL, K_NO_WAIT));
+
+	int ret = weave_poll(fds, ARRAY_SIZE(fds), queues, ARRAY_SIZE(queues), TEST_TIMEOUT_MS);
+
+	zassert_equal(ret, 0, "No socket ready");
+	zassert_equal(fds[0].revents, 0, "Socket revents cleared");
+	zassert_equal(atomic_get(&captures[1].count), 1, "Queue B processed by weave_poll");
+	zassert_equal(captures[1].last_ptr, &test_data, "Correct payload");
+	zassert_equal(atomic_get(&captures[0].count), 0, "Queue A untouched");
+}
+
+ZTEST(weave_poll_unit_test, test_poll_reports_ready_socket)
+{
+	struct zsock_pollfd fds[] = {{.fd = fake_sock, .events = ZSOCK_POLLIN}};
+
+	zvfs_eventfd_write(fake_sock, 1);
+
+	int ret = weave_poll(fds, ARRAY_SIZE(fds), queues, ARRAY_SIZE(queues), TEST_TIMEOUT_MS);
+
+	zassert_equal(ret, 1, "Socket should be ready");
+	zassert_true(fds[0].revents & ZSOCK_POLLIN, "POLLIN reported");
+	zassert_equal(atomic_get(&captures[0].count), 0, "No queue events");
+}
+
+ZTEST(weave_poll_unit_test, test_poll_socket_and_queue_together)
+{
+	int test_data = 0x113;
+	struct zsock_pollfd fds[] = {{.fd = fake_sock, .events = ZSOCK_POLLIN}};
+
+	zassert_ok(weave_sink_send(&sink_a, &test_data, NULL, K_NO_WAIT));
+	zassert_ok(weave_sink_send(&sink_a, &test_data, NULL, K_NO_WAIT));
+	zvfs_eventfd_write(fake_sock, 1);
+
+	int ret = weave_poll(fds, ARRAY_SIZE(fds), queues, ARRAY_SIZE(queues), TEST_TIMEOUT_MS);
+
+	zassert_equal(ret, 1, "Socket reported");
+	zassert_equal(atomic_get(&captures[0].count), 2, "Whole queue drained in one wakeup");
+}
+
+ZTEST(weave_poll_unit_test, test_poll_timeout)
+{
+	struct zsock_pollfd fds[] = {{.fd = fake_sock, .events = ZSOCK_POLLIN}};
+
+	int ret = weave_poll(fds, ARRAY_SIZE(fds), queues, ARRAY_SIZE(queues), 10);
+
+	zassert_equal(ret, 0, "Nothing ready");
+	zassert_equal(atomic_get(&captures[0].count) + atomic_get(&captures[1].count), 0,
+		      "No handlers called");
+}
+
+ZTEST(weave_poll_unit_test, test_poll_wakes_on_later_enqueue)
+{
+	int test_data = 0x113;
+
+	/* Idle poll re-arms the signal, the next enqueue must wake again */
+	zassert_equal(weave_poll(NULL, 0, queues, ARRAY_SIZE(queues), 0), 0, "Idle");
+
+	zassert_ok(weave_sink_send(&sink_a, &test_data, NULL, K_NO_WAIT));
+	zassert_equal(weave_poll(NULL, 0, queues, ARRAY_SIZE(queues), TEST_TIMEOUT_MS), 0,
+		      "Only queues polled");
+	zassert_equal(atomic_get(&captures[0].count), 1, "Woken by enqueue");
+}
+
+ZTEST(weave_poll_unit_test, test_poll_invalid)
+{
+	struct zsock_pollfd fds[CONFIG_WEAVE_POLL_MAX_FDS] = {0};
+
+	zassert_equal(weave_poll(NULL, 1, NULL, 0, 0), -EINVAL, "NULL fds");
+	zassert_equal(weave_poll(NULL, 0, NULL, 1, 0), -EINVAL, "NULL queues");
+	zassert_equal(weave_poll(NULL, -1, NULL, 0, 0), -EINVAL, "Negative nfds");
+	zassert_equal(weave_poll(fds, ARRAY_SIZE(fds), queues, 1, 0), -EINVAL,
+		      "Too many descriptors");
+}